@@ -14,6 +14,7 @@ public class HazardTools : ModuleRules
 				"HazardTools/Private",
 				"HazardTools/Private/PackageFlags",
 				"HazardTools/Private/ObjectOutliner",
+				"HazardTools/Private/NamePool",
 				"HazardTools/Private/StyleBrowser",
 			}
 		);
@@ -46,7 +47,8 @@ public class HazardTools : ModuleRules
 				"AssetTools",
 				"ToolMenus",
 				"ApplicationCore",
-				"MeshDescription"
+				"MeshDescription",
+				"DesktopPlatform"
 			}
 		);
 		DynamicallyLoadedModuleNames.AddRange(new string[] { });
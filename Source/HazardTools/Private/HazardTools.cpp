@@ -3,6 +3,15 @@
 #include "HazardTools.h"
 #include "HazardToolsUtils.h"
 #include "LevelEditor.h"
+#include "HazardToolsObjectOutlinerSettings.h"
+#include "ObjectOutlinerLeakDetector.h"
+#include "ObjectOutlinerPopulationTracker.h"
+#include "ObjectOutlinerSerializedSize.h"
+#include "ObjectOutlinerTickSampler.h"
+#include "ObjectOutlinerTimeline.h"
+#include "ObjectOutlinerTransientChurn.h"
+#include "ObjectOutlinerWatchList.h"
+#include "SNamePool.h"
 #include "SObjectOutliner.h"
 #include "SStyleBrowser.h"
 #include "PackageFlags/HazardToolsPackageFlags.h"
@@ -23,6 +32,18 @@ public:
 
 		if (!IsRunningCommandlet())
 		{
+			if (UHazardToolsObjectOutlinerSettings::Get().bEnablePopulationTracking)
+			{
+				HazardTools::FObjectOutlinerPopulationTracker::Startup();
+				HazardTools::FObjectOutlinerTimeline::Startup();
+				HazardTools::FObjectOutlinerTransientChurn::Startup();
+
+				if (UHazardToolsObjectOutlinerSettings::Get().bEnablePIELeakDetection)
+				{
+					HazardTools::FObjectOutlinerLeakDetector::Startup();
+				}
+			}
+
 			RegisterNomadTabSpawner("HazardToolsObjectOutlinerTab", INVTEXT("Object Outliner"), FOnSpawnTab::CreateLambda([](const FSpawnTabArgs&) {
 				return SNew(SDockTab)
 					.TabRole(NomadTab)
@@ -39,6 +60,14 @@ public:
 					];
 			}));
 
+			RegisterNomadTabSpawner("HazardToolsNamePoolTab", INVTEXT("Name Pool"), FOnSpawnTab::CreateLambda([](const FSpawnTabArgs&) {
+				return SNew(SDockTab)
+					.TabRole(NomadTab)
+					[
+						SNew(HazardTools::SNamePool)
+					];
+			}));
+
 			if (FSlateApplication::IsInitialized())
 			{
 				UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FHazardToolsModule::ExtendMenu));
@@ -53,6 +82,14 @@ public:
 		{
 			FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(NomadTabSpawnerName.Key);
 		}
+
+		HazardTools::FObjectOutlinerLeakDetector::Shutdown();
+		HazardTools::FObjectOutlinerWatchList::Shutdown();
+		HazardTools::FObjectOutlinerSerializedSizeCache::Shutdown();
+		HazardTools::FObjectOutlinerTransientChurn::Shutdown();
+		HazardTools::FObjectOutlinerTickSampler::Shutdown();
+		HazardTools::FObjectOutlinerTimeline::Shutdown();
+		HazardTools::FObjectOutlinerPopulationTracker::Shutdown();
 		UE_LOG(LogHazardTools, Log, TEXT("FHazardToolsModule::ShutdownModule"));
 	}
 
@@ -25,13 +25,49 @@ bool FHazardToolsUtils::HasSelectedAssets()
 	return SelectedAssets.Num() > 0;
 }
 
+bool FHazardToolsUtils::IsEditorIdle()
+{
+	return GIsRunning
+	       && GIsSlowTask == false
+	       && IsAsyncLoading() == false
+	       && FSlateApplication::IsInitialized()
+	       && FSlateApplication::Get().GetActiveModalWindow() == nullptr;
+}
+
 void FHazardToolsUtils::SetClipboardText(const FString& ClipboardText, const bool bLog, const bool bShowNotification, const bool bSuccess)
 {
 	FPlatformApplicationMisc::ClipboardCopy(*ClipboardText);
 
+	// Batch copies can be megabytes, notification and log only show the beginning
+	constexpr int32 MaxPreviewLines = 10;
+	constexpr int32 MaxPreviewLen = 1024;
+	FString PreviewText = ClipboardText.Left(MaxPreviewLen);
+	int32 LineEnd = INDEX_NONE;
+	for (int32 LineIndex = 0; LineIndex < MaxPreviewLines; ++LineIndex)
+	{
+		LineEnd = PreviewText.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, LineEnd + 1);
+		if (LineEnd == INDEX_NONE)
+		{
+			break;
+		}
+	}
+	if (LineEnd != INDEX_NONE)
+	{
+		PreviewText.LeftInline(LineEnd);
+	}
+	if (PreviewText.Len() < ClipboardText.Len())
+	{
+		int32 LinesNum = 1;
+		for (const TCHAR Char : ClipboardText)
+		{
+			LinesNum += Char == TEXT('\n') ? 1 : 0;
+		}
+		PreviewText += FString::Printf(TEXT("\n... (%d lines, %d characters)"), LinesNum, ClipboardText.Len());
+	}
+
 	if (bShowNotification)
 	{
-		const FText NotificationText = FText::Format(INVTEXT("Copied to clipboard:\n{0}"), FText::FromString(ClipboardText));
+		const FText NotificationText = FText::Format(INVTEXT("Copied to clipboard:\n{0}"), FText::FromString(PreviewText));
 		FNotificationInfo Info(NotificationText);
 		Info.ExpireDuration = 5.0f;
 
@@ -46,16 +82,16 @@ void FHazardToolsUtils::SetClipboardText(const FString& ClipboardText, const boo
 	{
 		if (bSuccess)
 		{
-			UE_LOG(LogHazardTools, Log, TEXT("Copied to clipboard: %s"), *ClipboardText);
+			UE_LOG(LogHazardTools, Log, TEXT("Copied to clipboard: %s"), *PreviewText);
 		}
 		else
 		{
-			UE_LOG(LogHazardTools, Warning, TEXT("Copied to clipboard: %s"), *ClipboardText);
+			UE_LOG(LogHazardTools, Warning, TEXT("Copied to clipboard: %s"), *PreviewText);
 		}
 	}
 }
 
-bool IsPropertyBuiltinStruct(const FStructProperty* StructProperty)
+bool FHazardToolsUtils::IsPropertyBuiltinStruct(const FStructProperty* StructProperty)
 {
 	static TSet<FName> BuiltinStructNames =
 	{
@@ -117,7 +153,7 @@ FString BuiltinStructPropertyToCompactString_Internal(const UStruct* StructDefin
 				ValueString = FString::FromInt(Val);
 			}
 		}
-		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property); IsPropertyBuiltinStruct(StructProperty))
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property); FHazardToolsUtils::IsPropertyBuiltinStruct(StructProperty))
 		{
 			ValueString = BuiltinStructPropertyToCompactString_Internal(StructProperty->Struct, Value);
 		}
@@ -133,6 +169,33 @@ FString BuiltinStructPropertyToCompactString_Internal(const UStruct* StructDefin
 	return Result;
 }
 
+FString FHazardToolsUtils::GetPropertyTypeName(const FProperty* Property)
+{
+	FString ClassName = Property->GetCPPType();
+
+	// Try to clean up namespaced enum class name
+	if (ClassName.StartsWith(TEXT("T"), ESearchCase::CaseSensitive))
+	{
+		if (ClassName.RemoveFromStart(TEXT("TEnumAsByte<")))
+		{
+			ClassName.RemoveFromEnd(TEXT("::Type>"));
+		}
+	}
+	return ClassName;
+}
+
+FString FHazardToolsUtils::PropertyValueToString(const FProperty* Property, const void* Value)
+{
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property); IsPropertyBuiltinStruct(StructProperty))
+	{
+		return BuiltinStructPropertyToCompactString_Internal(StructProperty->Struct, Value);
+	}
+
+	FString ValueString;
+	Property->ExportTextItem_Direct(ValueString, Value, nullptr, nullptr, PPF_None);
+	return ValueString;
+}
+
 void UStructToText_Internal(const UStruct* StructDefinition, const void* Struct, FTextBuilder& Builder)
 {
 	Builder.AppendLine(INVTEXT("{"));
@@ -142,25 +205,16 @@ void UStructToText_Internal(const UStruct* StructDefinition, const void* Struct,
 	{
 		const FProperty* Property = *It;
 		FString VariableName = Property->GetNameCPP();
-		FString ClassName = Property->GetCPPType();
+		FString ClassName = FHazardToolsUtils::GetPropertyTypeName(Property);
 		const void* Value = Property->ContainerPtrToValuePtr<uint8>(Struct);
 
-		// Try to clean up namespaced enum class name
-		if (ClassName.StartsWith(TEXT("T"), ESearchCase::CaseSensitive))
-		{
-			if (ClassName.RemoveFromStart(TEXT("TEnumAsByte<")))
-			{
-				ClassName.RemoveFromEnd(TEXT("::Type>"));
-			}
-		}
-
 		const FString PrefixString = FString::Printf(TEXT("%s%s</> %s ="), *FHazardToolsUtils::Tag_Prefix_Type, *ClassName, *VariableName);
 
 		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
 		{
-			if (IsPropertyBuiltinStruct(StructProperty))
+			if (FHazardToolsUtils::IsPropertyBuiltinStruct(StructProperty))
 			{
-				FString ValueString = BuiltinStructPropertyToCompactString_Internal(StructProperty->Struct, Value);
+				FString ValueString = FHazardToolsUtils::PropertyValueToString(StructProperty, Value);
 				Builder.AppendLineFormat(INVTEXT("{0} <SyntaxHighlight.NodeAttributeValue>{1}</>"), FText::FromString(PrefixString), FText::FromString(ValueString));
 			}
 			/*else 
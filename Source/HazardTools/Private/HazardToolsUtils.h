@@ -13,6 +13,9 @@ public:
 	// Does content browser has assets selected?
 	static bool HasSelectedAssets();
 
+	// Editor finished startup and is not busy with slow task, async loading or modal window. Used to defer heavy widget population.
+	static bool IsEditorIdle();
+
 	static void SetClipboardText(const FString& ClipboardText, const bool bLog = true, const bool bShowNotification = true, const bool bSuccess = true);
 
 	// Does not work with inheritance !
@@ -24,6 +27,13 @@ public:
 
 	static bool UStructToText(const UStruct* StructDefinition, const void* Struct, FText& OutText);
 
+	// Small math and color structs displayed inline as {X=1,Y=2} instead of nested members
+	static bool IsPropertyBuiltinStruct(const FStructProperty* StructProperty);
+	// C++ type, TEnumAsByte<EFoo::Type> shortened to EFoo
+	static FString GetPropertyTypeName(const FProperty* Property);
+	// Single value (not the whole static array) as plain text, builtin structs in compact form
+	static FString PropertyValueToString(const FProperty* Property, const void* Value);
+
 	static const FString Tag_Prefix_Type;
 	static const FString Tag_Prefix_Literal;
 	static const FString Tag_Suffix;
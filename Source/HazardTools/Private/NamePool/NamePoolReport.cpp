@@ -0,0 +1,205 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "NamePoolReport.h"
+
+#include "HazardTools.h"
+#include "ObjectOutlinerReport.h"
+#include "Async/ParallelFor.h"
+#include "UObject/UObjectIterator.h"
+
+namespace HazardTools
+{
+namespace NamePoolReport
+{
+// Stems listed in report, classes are only resolved for them
+constexpr int32 TopStemsNum = 500;
+constexpr int32 TopClassesPerStemNum = 20;
+
+struct FStemStats
+{
+	int32 EntriesNum = 0;
+	int64 Bytes = 0;
+	int32 WideNum = 0;
+};
+
+struct FStemRow
+{
+	FString Stem;
+	FStemStats Stats;
+	TMap<UClass*, int32> Classes;
+};
+
+// Splits Num items in chunks for ParallelFor, each chunk fills its own map without locking
+static int32 GetChunksNum(const int32 Num)
+{
+	return FMath::Clamp(Num / 16384, 1, FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads()) * 4);
+}
+}
+
+void StripNumericSuffix(FString& InOutName)
+{
+	int32 Length = InOutName.Len();
+	while (Length > 0 && FChar::IsDigit(InOutName[Length - 1]))
+	{
+		Length--;
+	}
+	// Keep "_" of names which are only digits and separators
+	while (Length > 1 && InOutName[Length - 1] == TEXT('_'))
+	{
+		Length--;
+	}
+	InOutName.LeftInline(Length, EAllowShrinking::No);
+}
+
+TSharedRef<FObjectOutlinerReport> MakeNamePoolReport()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(MakeNamePoolReport);
+	using namespace NamePoolReport;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Pointers to all entries, stable for the lifetime of the process
+	const TArray<const FNameEntry*> Entries = FName::DebugDump();
+
+	const int32 EntryChunksNum = GetChunksNum(Entries.Num());
+	TArray<TMap<FString, FStemStats>> ChunkStems;
+	ChunkStems.SetNum(EntryChunksNum);
+	ParallelFor(EntryChunksNum, [&](const int32 ChunkIndex)
+	{
+		TMap<FString, FStemStats>& Stems = ChunkStems[ChunkIndex];
+		const int32 Begin = Entries.Num() * int64(ChunkIndex) / EntryChunksNum;
+		const int32 End = Entries.Num() * int64(ChunkIndex + 1) / EntryChunksNum;
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			const FNameEntry* Entry = Entries[Index];
+			const bool bWide = Entry->IsWide();
+
+			FString Stem = Entry->GetPlainNameString();
+			const int32 Bytes = FNameEntry::GetSize(Stem.Len(), bWide == false);
+			StripNumericSuffix(Stem);
+
+			FStemStats& Stats = Stems.FindOrAdd(MoveTemp(Stem));
+			Stats.EntriesNum++;
+			Stats.Bytes += Bytes;
+			Stats.WideNum += bWide ? 1 : 0;
+		}
+	});
+
+	TMap<FString, FStemStats> Stems = MoveTemp(ChunkStems[0]);
+	for (int32 ChunkIndex = 1; ChunkIndex < EntryChunksNum; ++ChunkIndex)
+	{
+		for (TPair<FString, FStemStats>& Pair : ChunkStems[ChunkIndex])
+		{
+			FStemStats& Stats = Stems.FindOrAdd(MoveTemp(Pair.Key));
+			Stats.EntriesNum += Pair.Value.EntriesNum;
+			Stats.Bytes += Pair.Value.Bytes;
+			Stats.WideNum += Pair.Value.WideNum;
+		}
+	}
+	ChunkStems.Empty();
+
+	int64 TotalBytes = 0;
+	int32 WideNum = 0;
+	for (const TPair<FString, FStemStats>& Pair : Stems)
+	{
+		TotalBytes += Pair.Value.Bytes;
+		WideNum += Pair.Value.WideNum;
+	}
+
+	TArray<FStemRow> Rows;
+	Rows.Reserve(Stems.Num());
+	for (TPair<FString, FStemStats>& Pair : Stems)
+	{
+		Rows.Add({MoveTemp(Pair.Key), Pair.Value});
+	}
+	const int32 StemsNum = Rows.Num();
+	Rows.Sort([](const FStemRow& A, const FStemRow& B) { return A.Stats.EntriesNum != B.Stats.EntriesNum ? A.Stats.EntriesNum > B.Stats.EntriesNum : A.Stats.Bytes > B.Stats.Bytes; });
+	Rows.SetNum(FMath::Min(Rows.Num(), TopStemsNum));
+
+	TMap<FString, int32> RowIndices;
+	for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+	{
+		RowIndices.Add(Rows[RowIndex].Stem, RowIndex);
+	}
+
+	// Object names referencing top stems, counted per class
+	TArray<UObject*> Objects;
+	Objects.Reserve(GUObjectArray.GetObjectArrayNumMinusAvailable());
+	for (FThreadSafeObjectIterator It; It; ++It)
+	{
+		Objects.Add(*It);
+	}
+
+	const int32 ObjectChunksNum = GetChunksNum(Objects.Num());
+	TArray<TMap<TPair<int32, UClass*>, int32>> ChunkClasses;
+	ChunkClasses.SetNum(ObjectChunksNum);
+	ParallelFor(ObjectChunksNum, [&](const int32 ChunkIndex)
+	{
+		const int32 Begin = Objects.Num() * int64(ChunkIndex) / ObjectChunksNum;
+		const int32 End = Objects.Num() * int64(ChunkIndex + 1) / ObjectChunksNum;
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			FString Stem = Objects[Index]->GetFName().GetPlainNameString();
+			StripNumericSuffix(Stem);
+			if (const int32* RowIndex = RowIndices.Find(Stem))
+			{
+				ChunkClasses[ChunkIndex].FindOrAdd({*RowIndex, Objects[Index]->GetClass()})++;
+			}
+		}
+	});
+
+	for (const TMap<TPair<int32, UClass*>, int32>& Classes : ChunkClasses)
+	{
+		for (const TPair<TPair<int32, UClass*>, int32>& Pair : Classes)
+		{
+			Rows[Pair.Key.Key].Classes.FindOrAdd(Pair.Key.Value) += Pair.Value;
+		}
+	}
+
+	const double Duration = FPlatformTime::Seconds() - StartTime;
+
+	const TSharedRef<FObjectOutlinerReport> Report = MakeShared<FObjectOutlinerReport>(INVTEXT("Name Pool"));
+	const int32 Column_Name = Report->AddColumn("Name", INVTEXT("Stem / Object Class"), EObjectOutlinerReportColumnType::Text, 0.45f);
+	const int32 Column_Entries = Report->AddColumn("Entries", INVTEXT("Entries / Objects"), EObjectOutlinerReportColumnType::Number, 0.15f);
+	const int32 Column_Bytes = Report->AddColumn("Bytes", INVTEXT("Bytes"), EObjectOutlinerReportColumnType::Memory, 0.15f);
+	const int32 Column_Wide = Report->AddColumn("Wide", INVTEXT("Wide Entries"), EObjectOutlinerReportColumnType::Number, 0.1f);
+
+	for (FStemRow& Row : Rows)
+	{
+		FObjectOutlinerReportRow& StemRow = Report->AddRow();
+		StemRow.SetText(Column_Name, Row.Stem);
+		StemRow.SetValue(Column_Entries, Row.Stats.EntriesNum);
+		StemRow.SetValue(Column_Bytes, Row.Stats.Bytes);
+		StemRow.SetValue(Column_Wide, Row.Stats.WideNum);
+
+		Row.Classes.ValueSort([](const int32 A, const int32 B) { return A > B; });
+		int32 ClassIndex = 0;
+		for (const TPair<UClass*, int32>& Pair : Row.Classes)
+		{
+			if (ClassIndex++ == TopClassesPerStemNum)
+			{
+				break;
+			}
+			FObjectOutlinerReportRow& ClassRow = StemRow.AddChild(Report->Columns.Num());
+			ClassRow.SetText(Column_Name, Pair.Key->GetName());
+			ClassRow.SetValue(Column_Entries, Pair.Value);
+			ClassRow.Object = Pair.Key;
+		}
+	}
+
+	Report->Summary = FText::Format(
+		INVTEXT("{0} entries ({1} ANSI, {2} wide), {3} in entries, {4} allocated by pool. {5} distinct stems after stripping numeric suffixes, top {6} listed. Walked in {7} ms."),
+		FText::AsNumber(Entries.Num()),
+		FText::AsNumber(Entries.Num() - WideNum),
+		FText::AsNumber(WideNum),
+		FText::AsMemory(TotalBytes, IEC),
+		FText::AsMemory(FName::GetNameEntryMemorySize(), IEC),
+		FText::AsNumber(StemsNum),
+		FText::AsNumber(Rows.Num()),
+		FText::AsNumber(FMath::RoundToInt(Duration * 1000.0)));
+
+	UE_LOG(LogHazardTools, Log, TEXT("Name pool: %d entries, %d stems, analyzed in %.2f s"), Entries.Num(), StemsNum, Duration);
+
+	return Report;
+}
+}
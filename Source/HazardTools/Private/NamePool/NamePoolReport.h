@@ -0,0 +1,19 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace HazardTools
+{
+class FObjectOutlinerReport;
+
+/**
+ * Walks the global FName entry pool once: entry and byte totals, ANSI vs wide entries,
+ * and most common name stems (numeric suffixes stripped) with classes of live objects named by them.
+ */
+[[nodiscard]] TSharedRef<FObjectOutlinerReport> MakeNamePoolReport();
+
+// "Foo_C_12" -> "Foo_C", "Actor12" -> "Actor"
+void StripNumericSuffix(FString& InOutName);
+}
@@ -0,0 +1,43 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "SNamePool.h"
+
+#include "HazardToolsUtils.h"
+#include "NamePoolReport.h"
+#include "SObjectOutlinerReport.h"
+
+namespace HazardTools
+{
+void SNamePool::Construct(const FArguments& InArgs)
+{
+	ChildSlot
+	[
+		SAssignNew(ContentBox, SBox)
+		.HAlign(HAlign_Center)
+		.VAlign(VAlign_Center)
+		[
+			SNew(STextBlock)
+			.Text(INVTEXT("Scanning..."))
+		]
+	];
+
+	RegisterActiveTimer(0.1f, FWidgetActiveTimerDelegate::CreateSP(this, &ThisClass::HandleDeferredPopulate));
+}
+
+EActiveTimerReturnType SNamePool::HandleDeferredPopulate(double InCurrentTime, float InDeltaTime)
+{
+	if (FHazardToolsUtils::IsEditorIdle() == false)
+	{
+		return EActiveTimerReturnType::Continue;
+	}
+
+	ContentBox->SetHAlign(HAlign_Fill);
+	ContentBox->SetVAlign(VAlign_Fill);
+	ContentBox->SetContent(
+		SNew(SObjectOutlinerReport)
+		.Report(MakeNamePoolReport())
+		.Generator(FObjectOutlinerReportGenerator::CreateLambda([]() -> TSharedPtr<FObjectOutlinerReport> { return MakeNamePoolReport(); }))
+		.AutoRefreshInterval(10.f));
+	return EActiveTimerReturnType::Stop;
+}
+}
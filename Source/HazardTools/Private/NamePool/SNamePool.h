@@ -0,0 +1,31 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+
+namespace HazardTools
+{
+class FObjectOutlinerReport;
+
+// Name pool usage tab, report is generated when the tab is first painted and on refresh
+class SNamePool : public SCompoundWidget
+{
+	using ThisClass = SNamePool;
+public:
+	SLATE_BEGIN_ARGS(SNamePool)
+		{
+		}
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	// Pool walk waits until the tab is painted (active timers only tick for visible widgets) and editor is idle
+	EActiveTimerReturnType HandleDeferredPopulate(double InCurrentTime, float InDeltaTime);
+
+	TSharedPtr<SBox> ContentBox;
+};
+}
@@ -25,6 +25,13 @@ public:
 	UPROPERTY(config)
 	bool bShowOnlyCheckedObjects = false;
 
+	// Show only TopNBySizeNum objects with biggest exclusive resource size
+	UPROPERTY(config)
+	bool bShowTopNBySize = false;
+
+	UPROPERTY(config)
+	int32 TopNBySizeNum = 100;
+
 	// List or Tree
 	UPROPERTY(config)
 	uint8 DisplayMode = 0; // Default is List
@@ -36,4 +43,64 @@ public:
 	// Currently selected sorting mode
 	UPROPERTY(config)
 	uint8 SortMode;
+
+	// Track live object counters with GUObjectArray create/delete listeners. Read on editor startup.
+	UPROPERTY(config)
+	bool bEnablePopulationTracking = true;
+
+	// Object count timeline sampling period in seconds
+	UPROPERTY(config)
+	float TimelineSampleInterval = 5.f;
+
+	// Amount of biggest classes recorded with each timeline sample
+	UPROPERTY(config)
+	int32 TimelineTopClassesNum = 5;
+
+	// Max amount of timeline samples, oldest are overwritten (720 samples * 5 sec = 1 hour)
+	UPROPERTY(config)
+	int32 TimelineCapacity = 720;
+
+	// Compare object population before and after each PIE session, requires population tracking. Read on editor startup.
+	UPROPERTY(config)
+	bool bEnablePIELeakDetection = true;
+
+	// Amount of biggest leaked classes to find reference chain for (each search walks the whole object graph)
+	UPROPERTY(config)
+	int32 LeakRetentionPathsNum = 3;
+
+	// Game thread time per frame spent measuring serialized size of objects in background
+	UPROPERTY(config)
+	float SerializedSizeBudgetMs = 2.f;
+
+	// Game thread time per frame spent on batch actions over selected objects (open editors, mark as garbage)
+	UPROPERTY(config)
+	float BatchActionBudgetMs = 8.f;
+
+	// Packages holding more editor-only metadata than this are highlighted in metadata footprint report
+	UPROPERTY(config)
+	int32 MetadataReportThresholdKB = 256;
+
+	// Sliding window of transient package churn report, sampled with TimelineSampleInterval
+	UPROPERTY(config)
+	int32 TransientChurnWindowMinutes = 10;
+
+	// Frames in a window of tick functions analysis, enabled state is sampled once per frame
+	UPROPERTY(config)
+	int32 TickSampleFrames = 120;
+
+	// Treemap panel next to the outliner list
+	UPROPERTY(config)
+	bool bShowTreemap = false;
+
+	// Levels of nested rectangles laid out below the treemap zoom root
+	UPROPERTY(config)
+	int32 TreemapMaxDepth = 4;
+
+	// Read only virtualized property list instead of details view for selected object
+	UPROPERTY(config)
+	bool bUseFastInspector = false;
+
+	// Details view is rebuilt only after selection did not change for this long, 0 rebuilds on every change
+	UPROPERTY(config)
+	float DetailsViewDebounceSeconds = 0.2f;
 };
@@ -0,0 +1,73 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerAnalysis.h"
+
+namespace HazardTools
+{
+void GenerateAnalyses(TArray<TSharedPtr<FObjectOutlinerAnalysis>>& OutAnalyses)
+{
+	OutAnalyses.Add(MakeShared<FObjectOutlinerAnalysis>(FObjectOutlinerAnalysis{
+		"Analysis_RedundantMaterialInstances",
+		INVTEXT("Redundant Material Instances"),
+		INVTEXT("Group material instances with identical parent, static switches and overridden parameters"),
+		"Filter_Materials",
+		&AnalyzeRedundantMaterialInstances
+	}));
+
+	OutAnalyses.Add(MakeShared<FObjectOutlinerAnalysis>(FObjectOutlinerAnalysis{
+		"Analysis_MetadataFootprint",
+		INVTEXT("Metadata Footprint"),
+		INVTEXT("Memory held by metadata maps, import data, thumbnails and mesh descriptions, rolled up by package"),
+		"Filter_Meta",
+		&AnalyzeMetadataFootprint
+	}));
+
+	OutAnalyses.Add(MakeShared<FObjectOutlinerAnalysis>(FObjectOutlinerAnalysis{
+		"Analysis_ReflectionFootprint",
+		INVTEXT("Reflection and Bytecode Footprint"),
+		INVTEXT("Property and function counts, parameter sizes and blueprint bytecode per class, grouped by module or blueprint"),
+		"Filter_Fields",
+		&AnalyzeReflectionFootprint
+	}));
+
+	OutAnalyses.Add(MakeShared<FObjectOutlinerAnalysis>(FObjectOutlinerAnalysis{
+		"Analysis_LayoutPadding",
+		INVTEXT("Layout Padding"),
+		INVTEXT("Padding and unpacked bools in class and struct property layouts, multiplied by live instance count"),
+		"Filter_Fields",
+		&AnalyzeLayoutPadding
+	}));
+
+	OutAnalyses.Add(MakeShared<FObjectOutlinerAnalysis>(FObjectOutlinerAnalysis{
+		"Analysis_DefaultsDelta",
+		INVTEXT("Class Defaults Delta"),
+		INVTEXT("Which properties instances override from their archetype (template or class default object) and how much unique string and container data they hold"),
+		NAME_None,
+		&AnalyzeDefaultsDelta
+	}));
+
+	OutAnalyses.Add(MakeShared<FObjectOutlinerAnalysis>(FObjectOutlinerAnalysis{
+		"Analysis_TransientChurn",
+		INVTEXT("Transient Churn"),
+		INVTEXT("Objects created and destroyed in transient package per class over a sliding window, highlights classes which are never collected. Covers the whole transient package, not only displayed objects"),
+		"Filter_Transient",
+		&AnalyzeTransientChurn
+	}));
+
+	OutAnalyses.Add(MakeShared<FObjectOutlinerAnalysis>(FObjectOutlinerAnalysis{
+		"Analysis_ContentDuplicates",
+		INVTEXT("Content Duplicates"),
+		INVTEXT("Textures, static meshes and sound waves with identical source content. Meshes and sounds are matched by hashes stored with their source data, texture source payloads are loaded and hashed"),
+		NAME_None,
+		&AnalyzeContentDuplicates
+	}));
+
+	OutAnalyses.Add(MakeShared<FObjectOutlinerAnalysis>(FObjectOutlinerAnalysis{
+		"Analysis_TickFunctions",
+		INVTEXT("Tick Functions"),
+		INVTEXT("All registered tick functions of actors and components, including secondary ones, and tickable world subsystems in worlds of displayed objects, with tick group, interval, paused ticking and enabled frames sampled over a window. Enabled frames are n/a in the first report until frames were sampled"),
+		NAME_None,
+		&AnalyzeTickFunctions
+	}));
+}
+}
@@ -0,0 +1,36 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "ObjectOutlinerReport.h"
+
+namespace HazardTools
+{
+/**
+ * On demand analysis of objects currently displayed in the outliner, listed in "Analyze" toolbar menu.
+ * Produces a report shown with SObjectOutlinerReport, refresh runs it again on current outliner content.
+ */
+struct FObjectOutlinerAnalysis
+{
+	FName Name;
+	FText Title;
+	FText Tooltip;
+
+	// Drop-down filter the analysis is designed for, menu entry is enabled only while it is enabled. None means always enabled.
+	FName RequiredFilterName;
+
+	TFunction<TSharedPtr<FObjectOutlinerReport> (const TArray<UObject*>& Objects)> Run;
+};
+
+void GenerateAnalyses(TArray<TSharedPtr<FObjectOutlinerAnalysis>>& OutAnalyses);
+
+// Implemented in ObjectOutlinerAnalysis_*.cpp
+TSharedPtr<FObjectOutlinerReport> AnalyzeRedundantMaterialInstances(const TArray<UObject*>& Objects);
+TSharedPtr<FObjectOutlinerReport> AnalyzeMetadataFootprint(const TArray<UObject*>& Objects);
+TSharedPtr<FObjectOutlinerReport> AnalyzeReflectionFootprint(const TArray<UObject*>& Objects);
+TSharedPtr<FObjectOutlinerReport> AnalyzeLayoutPadding(const TArray<UObject*>& Objects);
+TSharedPtr<FObjectOutlinerReport> AnalyzeDefaultsDelta(const TArray<UObject*>& Objects);
+TSharedPtr<FObjectOutlinerReport> AnalyzeTransientChurn(const TArray<UObject*>& Objects);
+TSharedPtr<FObjectOutlinerReport> AnalyzeContentDuplicates(const TArray<UObject*>& Objects);
+TSharedPtr<FObjectOutlinerReport> AnalyzeTickFunctions(const TArray<UObject*>& Objects);
+}
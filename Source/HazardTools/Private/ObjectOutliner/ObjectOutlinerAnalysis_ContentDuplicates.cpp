@@ -0,0 +1,218 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerAnalysis.h"
+#include "HazardTools.h"
+#include "Async/ParallelFor.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture.h"
+#include "Hash/Blake3.h"
+#include "IO/IoHash.h"
+#include "MeshDescription.h"
+#include "Sound/SoundWave.h"
+#include "StaticMeshSourceData.h"
+
+namespace HazardTools
+{
+namespace ContentDuplicatesAnalysis
+{
+// Bytes passed to hasher at once while streaming a payload
+constexpr uint64 HashChunkSize = 1024 * 1024;
+
+struct FPayload
+{
+	UObject* Object = nullptr;
+	FIoHash Hash;
+	// Bytes stored in the package for this payload
+	int64 Size = 0;
+	bool bValid = false;
+};
+
+struct FGroup
+{
+	TArray<const FPayload*> Payloads;
+	int64 DuplicatedSize = 0;
+};
+
+/**
+ * Texture source doesn't expose hash of its bulk data and its id is a stored guid unless source uses hash as guid,
+ * so identical re-imports have different ids. Stored payload is hashed instead, one payload resident per worker, fed to hasher in chunks.
+ * Same image stored with different source compression (PNG vs raw) is not matched.
+ */
+static void HashTextureSource(UTexture* Texture, FPayload& OutPayload)
+{
+	FTextureSource& Source = Texture->Source;
+	if (Source.IsValid() == false)
+	{
+		return;
+	}
+
+	FBlake3 Hasher;
+	Source.OperateOnLoadedBulkData([&Hasher](const FSharedBuffer& Payload)
+	{
+		const uint8* Data = static_cast<const uint8*>(Payload.GetData());
+		for (uint64 Offset = 0; Offset < Payload.GetSize(); Offset += HashChunkSize)
+		{
+			Hasher.Update(Data + Offset, FMath::Min(HashChunkSize, Payload.GetSize() - Offset));
+		}
+	});
+	OutPayload.Hash = FIoHash(Hasher.Finalize());
+	OutPayload.Size = Source.GetSizeOnDisk();
+	OutPayload.bValid = true;
+}
+
+// Editor bulk data already keeps hash of its payload, nothing has to be loaded
+static void HashStaticMeshSource(const UStaticMesh* StaticMesh, FPayload& OutPayload)
+{
+	FBlake3 Hasher;
+	for (int32 LodIndex = 0; LodIndex < StaticMesh->GetNumSourceModels(); ++LodIndex)
+	{
+		const FMeshDescriptionBulkData* BulkData = StaticMesh->GetSourceModel(LodIndex).GetMeshDescriptionBulkData();
+		if (BulkData == nullptr || BulkData->IsEmpty())
+		{
+			continue;
+		}
+
+		const FIoHash PayloadId = BulkData->GetBulkData().GetPayloadId();
+		Hasher.Update(&PayloadId, sizeof(PayloadId));
+		OutPayload.Size += BulkData->GetBulkData().GetPayloadSize();
+		OutPayload.bValid = true;
+	}
+	OutPayload.Hash = FIoHash(Hasher.Finalize());
+}
+
+static void HashSoundWaveSource(const USoundWave* SoundWave, FPayload& OutPayload)
+{
+	if (SoundWave->RawData.HasPayloadData())
+	{
+		OutPayload.Hash = SoundWave->RawData.GetPayloadId();
+		OutPayload.Size = SoundWave->RawData.GetPayloadSize();
+		OutPayload.bValid = true;
+	}
+}
+
+static const TCHAR* GetKindName(const UObject* Object)
+{
+	return Object->IsA<UTexture>() ? TEXT("Texture") : Object->IsA<UStaticMesh>() ? TEXT("Static Mesh") : TEXT("Sound Wave");
+}
+}
+
+TSharedPtr<FObjectOutlinerReport> AnalyzeContentDuplicates(const TArray<UObject*>& Objects)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(AnalyzeContentDuplicates);
+	using namespace ContentDuplicatesAnalysis;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FPayload> Payloads;
+	for (UObject* Object : Objects)
+	{
+		if (Object->IsTemplate() == false && (Object->IsA<UTexture>() || Object->IsA<UStaticMesh>() || Object->IsA<USoundWave>()))
+		{
+			Payloads.AddDefaulted_GetRef().Object = Object;
+		}
+	}
+
+	// Meshes and sounds only read stored hashes, textures load their payload so only they are spread over workers
+	TArray<FPayload*> TexturePayloads;
+	for (FPayload& Payload : Payloads)
+	{
+		if (Payload.Object->IsA<UTexture>())
+		{
+			TexturePayloads.Add(&Payload);
+		}
+		else if (const UStaticMesh* StaticMesh = Cast<UStaticMesh>(Payload.Object))
+		{
+			HashStaticMeshSource(StaticMesh, Payload);
+		}
+		else
+		{
+			HashSoundWaveSource(CastChecked<USoundWave>(Payload.Object), Payload);
+		}
+	}
+
+	// Unbalanced, a single 8k texture costs more than hundreds of small ones
+	ParallelFor(TexturePayloads.Num(), [&TexturePayloads](const int32 Index)
+	{
+		HashTextureSource(CastChecked<UTexture>(TexturePayloads[Index]->Object), *TexturePayloads[Index]);
+	}, EParallelForFlags::Unbalanced);
+
+	// Class is part of the key, an empty sound and an empty mesh are not duplicates of each other
+	TMap<TPair<UClass*, FIoHash>, FGroup> GroupsMap;
+	int32 HashedNum = 0;
+	for (const FPayload& Payload : Payloads)
+	{
+		if (Payload.bValid)
+		{
+			GroupsMap.FindOrAdd({Payload.Object->GetClass(), Payload.Hash}).Payloads.Add(&Payload);
+			HashedNum++;
+		}
+	}
+
+	TArray<FGroup> Groups;
+	int32 DuplicatesNum = 0;
+	int64 TotalDuplicatedSize = 0;
+	for (TPair<TPair<UClass*, FIoHash>, FGroup>& Pair : GroupsMap)
+	{
+		FGroup& Group = Pair.Value;
+		if (Group.Payloads.Num() > 1)
+		{
+			// Keeping one copy, payload sizes of the same content may differ by source compression only
+			int64 MaxSize = 0;
+			for (const FPayload* Payload : Group.Payloads)
+			{
+				Group.DuplicatedSize += Payload->Size;
+				MaxSize = FMath::Max(MaxSize, Payload->Size);
+			}
+			Group.DuplicatedSize -= MaxSize;
+			DuplicatesNum += Group.Payloads.Num() - 1;
+			TotalDuplicatedSize += Group.DuplicatedSize;
+			Groups.Add(MoveTemp(Group));
+		}
+	}
+
+	Groups.Sort([](const FGroup& A, const FGroup& B) { return A.DuplicatedSize != B.DuplicatedSize ? A.DuplicatedSize > B.DuplicatedSize : A.Payloads.Num() > B.Payloads.Num(); });
+
+	const TSharedRef<FObjectOutlinerReport> Report = MakeShared<FObjectOutlinerReport>(INVTEXT("Content Duplicates"));
+	const int32 Column_Name = Report->AddColumn("Name", INVTEXT("Group / Asset"), EObjectOutlinerReportColumnType::Text, 0.3f);
+	const int32 Column_Kind = Report->AddColumn("Kind", INVTEXT("Kind"), EObjectOutlinerReportColumnType::Text, 0.1f);
+	const int32 Column_Count = Report->AddColumn("Count", INVTEXT("Count"), EObjectOutlinerReportColumnType::Number, 0.08f);
+	const int32 Column_Size = Report->AddColumn("Size", INVTEXT("Duplicated / Payload"), EObjectOutlinerReportColumnType::Memory, 0.12f);
+	const int32 Column_Path = Report->AddColumn("Path", INVTEXT("Hash / Path"), EObjectOutlinerReportColumnType::Text, 0.4f);
+
+	for (const FGroup& Group : Groups)
+	{
+		const FPayload& First = *Group.Payloads[0];
+
+		FObjectOutlinerReportRow& GroupRow = Report->AddRow();
+		GroupRow.SetText(Column_Name, First.Object->GetName());
+		GroupRow.SetText(Column_Kind, GetKindName(First.Object));
+		GroupRow.SetValue(Column_Count, Group.Payloads.Num());
+		GroupRow.SetValue(Column_Size, Group.DuplicatedSize);
+		GroupRow.SetText(Column_Path, LexToString(First.Hash));
+		GroupRow.Object = First.Object;
+
+		for (const FPayload* Payload : Group.Payloads)
+		{
+			FObjectOutlinerReportRow& AssetRow = GroupRow.AddChild(Report->Columns.Num());
+			AssetRow.SetText(Column_Name, Payload->Object->GetName());
+			AssetRow.SetText(Column_Kind, GetKindName(Payload->Object));
+			AssetRow.SetValue(Column_Count, 1);
+			AssetRow.SetValue(Column_Size, Payload->Size);
+			AssetRow.SetText(Column_Path, Payload->Object->GetPathName());
+			AssetRow.Object = Payload->Object;
+		}
+	}
+
+	Report->Summary = FText::Format(
+		INVTEXT("{0} of {1} textures, static meshes and sound waves have identical source content in {2} groups, {3} of duplicated source data. {4} objects had no source data."),
+		FText::AsNumber(DuplicatesNum),
+		FText::AsNumber(HashedNum),
+		FText::AsNumber(Groups.Num()),
+		FText::AsMemory(TotalDuplicatedSize, IEC),
+		FText::AsNumber(Payloads.Num() - HashedNum));
+
+	UE_LOG(LogHazardTools, Log, TEXT("Content duplicates: %d groups of %d objects, analyzed in %.2f s"), Groups.Num(), Payloads.Num(), FPlatformTime::Seconds() - StartTime);
+
+	return Report;
+}
+}
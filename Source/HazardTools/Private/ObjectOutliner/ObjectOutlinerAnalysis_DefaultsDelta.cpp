@@ -0,0 +1,263 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerAnalysis.h"
+#include "HazardTools.h"
+#include "Algo/Accumulate.h"
+#include "Algo/Count.h"
+#include "Async/ParallelFor.h"
+#include "UObject/TextProperty.h"
+
+namespace HazardTools
+{
+namespace DefaultsDeltaAnalysis
+{
+struct FClassLayout
+{
+	UClass* Class = nullptr;
+	const UObject* DefaultObject = nullptr;
+	// Transient properties are runtime state, overriding them is expected
+	TArray<const FProperty*> Properties;
+	TArray<UObject*> Instances;
+	// Per instance, parallel to Instances
+	TArray<const UObject*> Archetypes;
+
+	// Aggregated per property
+	TArray<int32> OverridesNum;
+	TArray<int64> UniqueBytes;
+	int64 TotalUniqueBytes = 0;
+	int32 OverriddenPropertiesNum = 0;
+};
+
+struct FOverride
+{
+	int32 PropertyIndex = 0;
+	int64 UniqueBytes = 0;
+};
+
+// Heap memory owned by value: string characters and container elements, recursing into structs and elements
+static int64 GetHeapSize(const FProperty* Property, const void* ValuePtr)
+{
+	if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+	{
+		return StrProperty->GetPropertyValue(ValuePtr).GetAllocatedSize();
+	}
+	if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+	{
+		return TextProperty->GetPropertyValue(ValuePtr).ToString().GetAllocatedSize();
+	}
+	if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper ArrayHelper(ArrayProperty, ValuePtr);
+		int64 Size = static_cast<int64>(ArrayHelper.Num()) * ArrayProperty->Inner->GetElementSize();
+		for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+		{
+			Size += GetHeapSize(ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index));
+		}
+		return Size;
+	}
+	if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		FScriptSetHelper SetHelper(SetProperty, ValuePtr);
+		int64 Size = static_cast<int64>(SetHelper.Num()) * SetProperty->SetLayout.Size;
+		for (FScriptSetHelper::FIterator It(SetHelper); It; ++It)
+		{
+			Size += GetHeapSize(SetProperty->ElementProp, SetHelper.GetElementPtr(It));
+		}
+		return Size;
+	}
+	if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		FScriptMapHelper MapHelper(MapProperty, ValuePtr);
+		int64 Size = static_cast<int64>(MapHelper.Num()) * MapProperty->MapLayout.SetLayout.Size;
+		for (FScriptMapHelper::FIterator It(MapHelper); It; ++It)
+		{
+			Size += GetHeapSize(MapProperty->KeyProp, MapHelper.GetKeyPtr(It));
+			Size += GetHeapSize(MapProperty->ValueProp, MapHelper.GetValuePtr(It));
+		}
+		return Size;
+	}
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		int64 Size = 0;
+		for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+		{
+			for (int32 ArrayIndex = 0; ArrayIndex < It->GetArrayDim(); ++ArrayIndex)
+			{
+				Size += GetHeapSize(*It, It->ContainerPtrToValuePtr<void>(ValuePtr, ArrayIndex));
+			}
+		}
+		return Size;
+	}
+	return 0;
+}
+
+// Instances created from a template or as Blueprint components start from their archetype, not from class default object.
+// Archetype of a parent class does not cover the whole layout, such instances are compared to class default object.
+static const UObject* GetComparisonBase(const UObject* Instance, const UObject* DefaultObject)
+{
+	const UObject* Archetype = Instance->GetArchetype();
+	return Archetype != nullptr && Archetype->GetClass() == Instance->GetClass() ? Archetype : DefaultObject;
+}
+
+static void FindOverrides(const FClassLayout& Layout, const UObject* Instance, const UObject* Archetype, TArray<FOverride>& OutOverrides)
+{
+	for (int32 PropertyIndex = 0; PropertyIndex < Layout.Properties.Num(); ++PropertyIndex)
+	{
+		const FProperty* Property = Layout.Properties[PropertyIndex];
+		for (int32 ArrayIndex = 0; ArrayIndex < Property->GetArrayDim(); ++ArrayIndex)
+		{
+			// Instanced subobjects are compared by content, not by pointer
+			if (Property->Identical_InContainer(Instance, Archetype, ArrayIndex, PPF_DeepCompareInstances) == false)
+			{
+				int64 UniqueBytes = 0;
+				for (int32 Index = 0; Index < Property->GetArrayDim(); ++Index)
+				{
+					UniqueBytes += GetHeapSize(Property, Property->ContainerPtrToValuePtr<void>(Instance, Index));
+				}
+				OutOverrides.Add({PropertyIndex, UniqueBytes});
+				break;
+			}
+		}
+	}
+}
+}
+
+TSharedPtr<FObjectOutlinerReport> AnalyzeDefaultsDelta(const TArray<UObject*>& Objects)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(AnalyzeDefaultsDelta);
+	using namespace DefaultsDeltaAnalysis;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TMap<UClass*, FClassLayout> Layouts;
+	for (UObject* Object : Objects)
+	{
+		if (Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+		{
+			continue;
+		}
+
+		UClass* Class = Object->GetClass();
+		FClassLayout& Layout = Layouts.FindOrAdd(Class);
+		if (Layout.Class == nullptr)
+		{
+			Layout.Class = Class;
+			Layout.DefaultObject = Class->GetDefaultObject(false);
+			for (TFieldIterator<FProperty> It(Class); It; ++It)
+			{
+				if (It->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient) == false)
+				{
+					Layout.Properties.Add(*It);
+				}
+			}
+		}
+		if (Layout.DefaultObject != nullptr)
+		{
+			Layout.Instances.Add(Object);
+			Layout.Archetypes.Add(GetComparisonBase(Object, Layout.DefaultObject));
+		}
+	}
+
+	// Flat list of work, comparisons only read property memory of instance and its archetype resolved above on game thread
+	TArray<TPair<FClassLayout*, int32>> Work;
+	for (TPair<UClass*, FClassLayout>& Pair : Layouts)
+	{
+		for (int32 InstanceIndex = 0; InstanceIndex < Pair.Value.Instances.Num(); ++InstanceIndex)
+		{
+			Work.Emplace(&Pair.Value, InstanceIndex);
+		}
+	}
+
+	TArray<TArray<FOverride>> Results;
+	Results.SetNum(Work.Num());
+	ParallelFor(Work.Num(), [&](const int32 Index)
+	{
+		const FClassLayout& Layout = *Work[Index].Key;
+		const int32 InstanceIndex = Work[Index].Value;
+		FindOverrides(Layout, Layout.Instances[InstanceIndex], Layout.Archetypes[InstanceIndex], Results[Index]);
+	});
+
+	for (TPair<UClass*, FClassLayout>& Pair : Layouts)
+	{
+		Pair.Value.OverridesNum.SetNumZeroed(Pair.Value.Properties.Num());
+		Pair.Value.UniqueBytes.SetNumZeroed(Pair.Value.Properties.Num());
+	}
+
+	for (int32 Index = 0; Index < Work.Num(); ++Index)
+	{
+		FClassLayout& Layout = *Work[Index].Key;
+		for (const FOverride& Override : Results[Index])
+		{
+			Layout.OverridesNum[Override.PropertyIndex]++;
+			Layout.UniqueBytes[Override.PropertyIndex] += Override.UniqueBytes;
+			Layout.TotalUniqueBytes += Override.UniqueBytes;
+		}
+	}
+
+	TArray<FClassLayout*> SortedLayouts;
+	for (TPair<UClass*, FClassLayout>& Pair : Layouts)
+	{
+		Pair.Value.OverriddenPropertiesNum = Algo::CountIf(Pair.Value.OverridesNum, [](const int32 Num) { return Num > 0; });
+		if (Pair.Value.OverriddenPropertiesNum > 0)
+		{
+			SortedLayouts.Add(&Pair.Value);
+		}
+	}
+	SortedLayouts.Sort([](const FClassLayout& A, const FClassLayout& B)
+	{
+		return A.TotalUniqueBytes != B.TotalUniqueBytes ? A.TotalUniqueBytes > B.TotalUniqueBytes : A.Instances.Num() > B.Instances.Num();
+	});
+
+	const TSharedRef<FObjectOutlinerReport> Report = MakeShared<FObjectOutlinerReport>(INVTEXT("Class Defaults Delta"));
+	const int32 Column_Name = Report->AddColumn("Name", INVTEXT("Class / Property"), EObjectOutlinerReportColumnType::Text, 0.3f);
+	const int32 Column_Instances = Report->AddColumn("Instances", INVTEXT("Instances"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_Overrides = Report->AddColumn("Overrides", INVTEXT("Overridden"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_Percent = Report->AddColumn("Percent", INVTEXT("Override %"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_Unique = Report->AddColumn("Unique", INVTEXT("Unique Data"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Type = Report->AddColumn("Type", INVTEXT("Type"), EObjectOutlinerReportColumnType::Text, 0.3f);
+
+	int32 InstancesNum = 0;
+	for (const FClassLayout* Layout : SortedLayouts)
+	{
+		InstancesNum += Layout->Instances.Num();
+
+		FObjectOutlinerReportRow& ClassRow = Report->AddRow();
+		ClassRow.SetText(Column_Name, Layout->Class->GetName());
+		ClassRow.SetValue(Column_Instances, Layout->Instances.Num());
+		ClassRow.SetValue(Column_Overrides, Layout->OverriddenPropertiesNum);
+		ClassRow.SetValue(Column_Unique, Layout->TotalUniqueBytes);
+		ClassRow.SetText(Column_Type, FString::Printf(TEXT("%d of %d properties overridden"), Layout->OverriddenPropertiesNum, Layout->Properties.Num()));
+		ClassRow.Object = Layout->Class;
+
+		for (int32 PropertyIndex = 0; PropertyIndex < Layout->Properties.Num(); ++PropertyIndex)
+		{
+			const int32 OverridesNum = Layout->OverridesNum[PropertyIndex];
+			if (OverridesNum == 0)
+			{
+				continue;
+			}
+
+			const FProperty* Property = Layout->Properties[PropertyIndex];
+			FObjectOutlinerReportRow& PropertyRow = ClassRow.AddChild(Report->Columns.Num());
+			PropertyRow.SetText(Column_Name, Property->GetName());
+			PropertyRow.SetValue(Column_Instances, Layout->Instances.Num());
+			PropertyRow.SetValue(Column_Overrides, OverridesNum);
+			PropertyRow.SetValue(Column_Percent, 100 * OverridesNum / Layout->Instances.Num());
+			PropertyRow.SetValue(Column_Unique, Layout->UniqueBytes[PropertyIndex]);
+			PropertyRow.SetText(Column_Type, Property->GetCPPType());
+			// Overridden by every instance (and more than one), archetype value is never used and the default could be changed
+			PropertyRow.bHighlight = OverridesNum == Layout->Instances.Num() && Layout->Instances.Num() > 1;
+		}
+	}
+
+	Report->Summary = FText::Format(
+		INVTEXT("{0} instances of {1} classes override their archetype (template or class default object), holding {2} of unique string and container data. Highlighted properties are overridden by every instance."),
+		FText::AsNumber(InstancesNum),
+		FText::AsNumber(SortedLayouts.Num()),
+		FText::AsMemory(Algo::TransformAccumulate(SortedLayouts, [](const FClassLayout* Layout) { return Layout->TotalUniqueBytes; }, static_cast<int64>(0)), IEC));
+
+	UE_LOG(LogHazardTools, Log, TEXT("Class defaults delta: %d instances compared, analyzed in %.2f s"), Work.Num(), FPlatformTime::Seconds() - StartTime);
+
+	return Report;
+}
+}
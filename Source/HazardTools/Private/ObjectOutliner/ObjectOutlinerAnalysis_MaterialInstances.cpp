@@ -0,0 +1,249 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerAnalysis.h"
+#include "ObjectOutlinerPropertyHash.h"
+#include "HazardTools.h"
+#include "Async/ParallelFor.h"
+#include "Materials/MaterialInstance.h"
+
+namespace HazardTools
+{
+namespace MaterialInstanceAnalysis
+{
+// Everything defining instance look and shader permutation. Names missing in current engine version are skipped.
+static const TCHAR* KeyPropertyNames[] =
+{
+	TEXT("Parent"),
+	TEXT("StaticParametersRuntime"),
+	TEXT("StaticParametersEditorOnly"),
+	TEXT("ScalarParameterValues"),
+	TEXT("VectorParameterValues"),
+	TEXT("DoubleVectorParameterValues"),
+	TEXT("TextureParameterValues"),
+	TEXT("TextureCollectionParameterValues"),
+	TEXT("RuntimeVirtualTextureParameterValues"),
+	TEXT("SparseVolumeTextureParameterValues"),
+	TEXT("FontParameterValues"),
+	TEXT("BasePropertyOverrides"),
+	TEXT("bOverrideSubsurfaceProfile"),
+	TEXT("SubsurfaceProfile"),
+	TEXT("PhysMaterial"),
+};
+
+static void GetKeyProperties(TArray<const FProperty*>& OutProperties)
+{
+	for (const TCHAR* PropertyName : KeyPropertyNames)
+	{
+		if (const FProperty* Property = FindFProperty<FProperty>(UMaterialInstance::StaticClass(), PropertyName))
+		{
+			OutProperties.Add(Property);
+		}
+	}
+}
+
+// Overridden parameters are stored in the order they were overridden in editor, the order must not matter
+static uint32 HashKeyProperty(const FProperty* Property, const UMaterialInstance* Instance)
+{
+	if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(Instance));
+		TArray<uint32, TInlineAllocator<32>> ElementHashes;
+		for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+		{
+			ElementHashes.Add(FObjectOutlinerPropertyHash::HashValue(ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index)));
+		}
+		ElementHashes.Sort();
+		return FCrc::MemCrc32(ElementHashes.GetData(), ElementHashes.Num() * sizeof(uint32));
+	}
+	return FObjectOutlinerPropertyHash::HashProperty(Property, Instance);
+}
+
+static bool IsKeyPropertyIdentical(const FProperty* Property, const UMaterialInstance* A, const UMaterialInstance* B)
+{
+	if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper ArrayHelperA(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(A));
+		FScriptArrayHelper ArrayHelperB(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(B));
+		if (ArrayHelperA.Num() != ArrayHelperB.Num())
+		{
+			return false;
+		}
+
+		// Parameter arrays are small, quadratic unordered compare is fine
+		for (int32 IndexA = 0; IndexA < ArrayHelperA.Num(); ++IndexA)
+		{
+			bool bFound = false;
+			for (int32 IndexB = 0; IndexB < ArrayHelperB.Num() && bFound == false; ++IndexB)
+			{
+				bFound = ArrayProperty->Inner->Identical(ArrayHelperA.GetRawPtr(IndexA), ArrayHelperB.GetRawPtr(IndexB), PPF_None);
+			}
+			if (bFound == false)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	for (int32 ArrayIndex = 0; ArrayIndex < Property->GetArrayDim(); ++ArrayIndex)
+	{
+		if (Property->Identical_InContainer(A, B, ArrayIndex, PPF_None) == false)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool AreInstancesIdentical(const UMaterialInstance* A, const UMaterialInstance* B, const TArray<const FProperty*>& KeyProperties)
+{
+	if (A->GetClass() != B->GetClass())
+	{
+		return false;
+	}
+	for (const FProperty* Property : KeyProperties)
+	{
+		if (IsKeyPropertyIdentical(Property, A, B) == false)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+struct FCluster
+{
+	TArray<UMaterialInstance*> Instances;
+	TArray<int64> Memory;
+	int64 Savings = 0;
+};
+}
+
+TSharedPtr<FObjectOutlinerReport> AnalyzeRedundantMaterialInstances(const TArray<UObject*>& Objects)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(AnalyzeRedundantMaterialInstances);
+	using namespace MaterialInstanceAnalysis;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<UMaterialInstance*> Instances;
+	for (UObject* Object : Objects)
+	{
+		if (UMaterialInstance* Instance = Cast<UMaterialInstance>(Object); Instance != nullptr && Instance->IsTemplate() == false)
+		{
+			Instances.Add(Instance);
+		}
+	}
+
+	TArray<const FProperty*> KeyProperties;
+	GetKeyProperties(KeyProperties);
+
+	// Hashing only reads reflected memory, safe to run in parallel
+	TArray<uint32> Hashes;
+	Hashes.SetNumUninitialized(Instances.Num());
+	ParallelFor(Instances.Num(), [&](const int32 Index)
+	{
+		const UMaterialInstance* Instance = Instances[Index];
+		uint32 Hash = PointerHash(Instance->GetClass());
+		for (const FProperty* Property : KeyProperties)
+		{
+			Hash = HashCombineFast(Hash, HashKeyProperty(Property, Instance));
+		}
+		Hashes[Index] = Hash;
+	});
+
+	TMap<uint32, TArray<UMaterialInstance*>> Buckets;
+	for (int32 Index = 0; Index < Instances.Num(); ++Index)
+	{
+		Buckets.FindOrAdd(Hashes[Index]).Add(Instances[Index]);
+	}
+
+	// Equal hash is confirmed by exact comparison, on collision a bucket is split into several clusters
+	TArray<FCluster> Clusters;
+	for (TPair<uint32, TArray<UMaterialInstance*>>& Pair : Buckets)
+	{
+		if (Pair.Value.Num() < 2)
+		{
+			continue;
+		}
+
+		TArray<FCluster> BucketClusters;
+		for (UMaterialInstance* Instance : Pair.Value)
+		{
+			FCluster* Cluster = BucketClusters.FindByPredicate([&](const FCluster& Candidate) { return AreInstancesIdentical(Candidate.Instances[0], Instance, KeyProperties); });
+			if (Cluster == nullptr)
+			{
+				Cluster = &BucketClusters.AddDefaulted_GetRef();
+			}
+			Cluster->Instances.Add(Instance);
+		}
+
+		for (FCluster& Cluster : BucketClusters)
+		{
+			if (Cluster.Instances.Num() > 1)
+			{
+				Clusters.Add(MoveTemp(Cluster));
+			}
+		}
+	}
+
+	// Keeping the biggest instance of each cluster, all others could be replaced by it
+	int32 RedundantNum = 0;
+	int64 TotalSavings = 0;
+	for (FCluster& Cluster : Clusters)
+	{
+		int64 MaxMemory = 0;
+		for (const UMaterialInstance* Instance : Cluster.Instances)
+		{
+			const int64 InstanceMemory = Instance->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+			Cluster.Memory.Add(InstanceMemory);
+			Cluster.Savings += InstanceMemory;
+			MaxMemory = FMath::Max(MaxMemory, InstanceMemory);
+		}
+		Cluster.Savings -= MaxMemory;
+		RedundantNum += Cluster.Instances.Num() - 1;
+		TotalSavings += Cluster.Savings;
+	}
+
+	Clusters.Sort([](const FCluster& A, const FCluster& B) { return A.Savings != B.Savings ? A.Savings > B.Savings : A.Instances.Num() > B.Instances.Num(); });
+
+	const TSharedRef<FObjectOutlinerReport> Report = MakeShared<FObjectOutlinerReport>(INVTEXT("Redundant Material Instances"));
+	const int32 Column_Name = Report->AddColumn("Name", INVTEXT("Cluster / Instance"), EObjectOutlinerReportColumnType::Text, 0.35f);
+	const int32 Column_Count = Report->AddColumn("Count", INVTEXT("Count"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_Memory = Report->AddColumn("Memory", INVTEXT("Savings / Memory"), EObjectOutlinerReportColumnType::Memory, 0.15f);
+	const int32 Column_Path = Report->AddColumn("Path", INVTEXT("Parent / Path"), EObjectOutlinerReportColumnType::Text, 0.4f);
+
+	for (const FCluster& Cluster : Clusters)
+	{
+		const UMaterialInterface* Parent = Cluster.Instances[0]->Parent;
+
+		FObjectOutlinerReportRow& ClusterRow = Report->AddRow();
+		ClusterRow.SetText(Column_Name, Cluster.Instances[0]->GetName());
+		ClusterRow.SetValue(Column_Count, Cluster.Instances.Num());
+		ClusterRow.SetValue(Column_Memory, Cluster.Savings);
+		ClusterRow.SetText(Column_Path, Parent != nullptr ? Parent->GetPathName() : TEXT("None"));
+		ClusterRow.Object = Cluster.Instances[0];
+
+		for (int32 Index = 0; Index < Cluster.Instances.Num(); ++Index)
+		{
+			FObjectOutlinerReportRow& InstanceRow = ClusterRow.AddChild(Report->Columns.Num());
+			InstanceRow.SetText(Column_Name, Cluster.Instances[Index]->GetName());
+			InstanceRow.SetValue(Column_Count, 1);
+			InstanceRow.SetValue(Column_Memory, Cluster.Memory[Index]);
+			InstanceRow.SetText(Column_Path, Cluster.Instances[Index]->GetPathName());
+			InstanceRow.Object = Cluster.Instances[Index];
+		}
+	}
+
+	Report->Summary = FText::Format(
+		INVTEXT("{0} of {1} material instances are parameter identical duplicates in {2} clusters, estimated savings {3}. Savings keep the biggest instance of each cluster."),
+		FText::AsNumber(RedundantNum),
+		FText::AsNumber(Instances.Num()),
+		FText::AsNumber(Clusters.Num()),
+		FText::AsMemory(TotalSavings, IEC));
+
+	UE_LOG(LogHazardTools, Log, TEXT("Redundant material instances: %d clusters of %d instances, analyzed in %.2f s"), Clusters.Num(), Instances.Num(), FPlatformTime::Seconds() - StartTime);
+
+	return Report;
+}
+}
@@ -0,0 +1,239 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerAnalysis.h"
+#include "HazardTools.h"
+#include "HazardToolsObjectOutlinerSettings.h"
+#include "MeshDescriptionBase.h"
+#include "EditorFramework/AssetImportData.h"
+#include "Misc/ObjectThumbnail.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/MetaData.h"
+
+namespace HazardTools
+{
+namespace MetadataAnalysis
+{
+enum class ECategory : uint8
+{
+	MetaData,
+	ImportData,
+	Thumbnails,
+	Other,
+	Num
+};
+
+struct FObjectFootprint
+{
+	UObject* Object = nullptr;
+	ECategory Category = ECategory::Other;
+	int64 Size = 0;
+};
+
+struct FPackageFootprint
+{
+	TArray<FObjectFootprint> Objects;
+	int64 Sizes[static_cast<int32>(ECategory::Num)] = {};
+	int64 Total = 0;
+};
+
+static int64 GetStringMapSize(const TMap<FName, FString>& Map)
+{
+	int64 Size = Map.GetAllocatedSize();
+	for (const TPair<FName, FString>& Pair : Map)
+	{
+		Size += Pair.Value.GetAllocatedSize();
+	}
+	return Size;
+}
+
+static int64 MeasureMetaData(const UMetaData* MetaData)
+{
+	int64 Size = MetaData->GetClass()->GetStructureSize();
+	Size += MetaData->ObjectMetaDataMap.GetAllocatedSize();
+	for (const TPair<FWeakObjectPtr, TMap<FName, FString>>& Pair : MetaData->ObjectMetaDataMap)
+	{
+		Size += GetStringMapSize(Pair.Value);
+	}
+	Size += GetStringMapSize(MetaData->RootMetaDataMap);
+	return Size;
+}
+
+static int64 MeasureImportData(const UAssetImportData* ImportData)
+{
+	int64 Size = ImportData->GetClass()->GetStructureSize();
+#if WITH_EDITORONLY_DATA
+	Size += ImportData->SourceData.SourceFiles.GetAllocatedSize();
+	for (const FAssetImportInfo::FSourceFile& SourceFile : ImportData->SourceData.SourceFiles)
+	{
+		Size += SourceFile.RelativeFilename.GetAllocatedSize();
+		Size += SourceFile.DisplayLabelName.GetAllocatedSize();
+	}
+#endif
+	return Size;
+}
+
+// Bulk data payload counts only while it is loaded, otherwise it stays in the package or virtualized storage
+static int64 MeasureMeshDescriptionBulkData(const UMeshDescriptionBaseBulkData* BulkData)
+{
+	int64 Size = BulkData->GetClass()->GetStructureSize();
+	const UE::Serialization::FEditorBulkData& EditorBulkData = BulkData->GetBulkData().GetBulkData();
+	if (EditorBulkData.IsDataLoaded())
+	{
+		Size += EditorBulkData.GetPayloadSize();
+	}
+	return Size;
+}
+
+// Unpacked mesh description, its element and attribute arrays are counted by serializing them to a memory counting archive
+static int64 MeasureMeshDescription(UMeshDescriptionBase* MeshDescriptionBase)
+{
+	FArchiveCountMem CountMem(nullptr);
+	CountMem << MeshDescriptionBase->GetMeshDescription();
+	return MeshDescriptionBase->GetClass()->GetStructureSize() + CountMem.GetMax();
+}
+
+// Thumbnails are not objects, they are kept in a map owned by the package
+static int64 MeasurePackageThumbnails(const UPackage* Package)
+{
+	if (Package->HasThumbnailMap() == false)
+	{
+		return 0;
+	}
+
+	const FThumbnailMap& ThumbnailMap = Package->GetThumbnailMap();
+	int64 Size = ThumbnailMap.GetAllocatedSize();
+	for (const TPair<FName, FObjectThumbnail>& Pair : ThumbnailMap)
+	{
+		Size += Pair.Value.CountImageBytes_Compressed();
+		Size += Pair.Value.CountImageBytes_Uncompressed();
+	}
+	return Size;
+}
+
+static FObjectFootprint MeasureObject(UObject* Object)
+{
+	FObjectFootprint Footprint;
+	Footprint.Object = Object;
+	if (const UMetaData* MetaData = Cast<UMetaData>(Object))
+	{
+		Footprint.Category = ECategory::MetaData;
+		Footprint.Size = MeasureMetaData(MetaData);
+	}
+	else if (const UAssetImportData* ImportData = Cast<UAssetImportData>(Object))
+	{
+		Footprint.Category = ECategory::ImportData;
+		Footprint.Size = MeasureImportData(ImportData);
+	}
+	else if (const UMeshDescriptionBaseBulkData* MeshDescriptionBulkData = Cast<UMeshDescriptionBaseBulkData>(Object))
+	{
+		Footprint.Category = ECategory::Other;
+		Footprint.Size = MeasureMeshDescriptionBulkData(MeshDescriptionBulkData);
+	}
+	else if (UMeshDescriptionBase* MeshDescriptionBase = Cast<UMeshDescriptionBase>(Object))
+	{
+		Footprint.Category = ECategory::Other;
+		Footprint.Size = MeasureMeshDescription(MeshDescriptionBase);
+	}
+	else
+	{
+		// Thumbnail infos and the rest only hold a few properties, their images are measured per package
+		Footprint.Category = ECategory::Other;
+		Footprint.Size = Object->GetClass()->GetStructureSize();
+	}
+	return Footprint;
+}
+}
+
+TSharedPtr<FObjectOutlinerReport> AnalyzeMetadataFootprint(const TArray<UObject*>& Objects)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(AnalyzeMetadataFootprint);
+	using namespace MetadataAnalysis;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TMap<UPackage*, FPackageFootprint> Packages;
+	for (UObject* Object : Objects)
+	{
+		FPackageFootprint& PackageFootprint = Packages.FindOrAdd(Object->GetOutermost());
+		if (Object->IsA<UPackage>())
+		{
+			continue; // Package itself only brings its thumbnails, measured below
+		}
+
+		const FObjectFootprint& ObjectFootprint = PackageFootprint.Objects.Add_GetRef(MeasureObject(Object));
+		PackageFootprint.Sizes[static_cast<int32>(ObjectFootprint.Category)] += ObjectFootprint.Size;
+	}
+
+	for (TPair<UPackage*, FPackageFootprint>& Pair : Packages)
+	{
+		Pair.Value.Sizes[static_cast<int32>(ECategory::Thumbnails)] = MeasurePackageThumbnails(Pair.Key);
+		for (const int64 Size : Pair.Value.Sizes)
+		{
+			Pair.Value.Total += Size;
+		}
+	}
+
+	// Drop packages reached only through unrelated objects (e.g. Meta filter disabled), nothing to report for them
+	for (auto It = Packages.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Total == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	Packages.ValueSort([](const FPackageFootprint& A, const FPackageFootprint& B) { return A.Total > B.Total; });
+
+	const TSharedRef<FObjectOutlinerReport> Report = MakeShared<FObjectOutlinerReport>(INVTEXT("Metadata Footprint"));
+	const int32 Column_Name = Report->AddColumn("Name", INVTEXT("Package / Object"), EObjectOutlinerReportColumnType::Text, 0.4f);
+	const int32 Column_Total = Report->AddColumn("Total", INVTEXT("Total"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_MetaData = Report->AddColumn("MetaData", INVTEXT("Metadata Maps"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_ImportData = Report->AddColumn("ImportData", INVTEXT("Import Data"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Thumbnails = Report->AddColumn("Thumbnails", INVTEXT("Thumbnails"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Other = Report->AddColumn("Other", INVTEXT("Mesh Descriptions / Other"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Class = Report->AddColumn("Class", INVTEXT("Class"), EObjectOutlinerReportColumnType::Text, 0.1f);
+
+	const int32 CategoryColumns[static_cast<int32>(ECategory::Num)] = {Column_MetaData, Column_ImportData, Column_Thumbnails, Column_Other};
+
+	const int64 Threshold = static_cast<int64>(UHazardToolsObjectOutlinerSettings::Get().MetadataReportThresholdKB) * 1024;
+	int32 FlaggedNum = 0;
+	int64 TotalSize = 0;
+	for (const TPair<UPackage*, FPackageFootprint>& Pair : Packages)
+	{
+		FObjectOutlinerReportRow& PackageRow = Report->AddRow();
+		PackageRow.SetText(Column_Name, Pair.Key->GetName());
+		PackageRow.SetValue(Column_Total, Pair.Value.Total);
+		for (int32 CategoryIndex = 0; CategoryIndex < static_cast<int32>(ECategory::Num); ++CategoryIndex)
+		{
+			PackageRow.SetValue(CategoryColumns[CategoryIndex], Pair.Value.Sizes[CategoryIndex]);
+		}
+		PackageRow.SetText(Column_Class, Pair.Key->GetClass()->GetName());
+		PackageRow.Object = Pair.Key;
+		PackageRow.bHighlight = Pair.Value.Total > Threshold;
+
+		FlaggedNum += PackageRow.bHighlight ? 1 : 0;
+		TotalSize += Pair.Value.Total;
+
+		for (const FObjectFootprint& ObjectFootprint : Pair.Value.Objects)
+		{
+			FObjectOutlinerReportRow& ObjectRow = PackageRow.AddChild(Report->Columns.Num());
+			ObjectRow.SetText(Column_Name, ObjectFootprint.Object->GetName());
+			ObjectRow.SetValue(Column_Total, ObjectFootprint.Size);
+			ObjectRow.SetValue(CategoryColumns[static_cast<int32>(ObjectFootprint.Category)], ObjectFootprint.Size);
+			ObjectRow.SetText(Column_Class, ObjectFootprint.Object->GetClass()->GetName());
+			ObjectRow.Object = ObjectFootprint.Object;
+		}
+	}
+
+	Report->Summary = FText::Format(
+		INVTEXT("{0} editor-only metadata in {1} packages. {2} packages above {3} threshold are highlighted, consider stripping or deferring their metadata."),
+		FText::AsMemory(TotalSize, IEC),
+		FText::AsNumber(Packages.Num()),
+		FText::AsNumber(FlaggedNum),
+		FText::AsMemory(Threshold, IEC));
+
+	UE_LOG(LogHazardTools, Log, TEXT("Metadata footprint: %d packages, analyzed in %.2f s"), Packages.Num(), FPlatformTime::Seconds() - StartTime);
+
+	return Report;
+}
+}
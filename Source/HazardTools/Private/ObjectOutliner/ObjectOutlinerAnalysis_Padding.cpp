@@ -0,0 +1,217 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerAnalysis.h"
+#include "HazardTools.h"
+
+namespace HazardTools
+{
+namespace PaddingAnalysis
+{
+struct FGap
+{
+	FName AfterProperty;
+	int32 Offset = 0;
+	int32 Size = 0;
+};
+
+struct FLayoutWaste
+{
+	UStruct* Struct = nullptr;
+	int32 PaddingSize = 0;
+	int32 NativeBoolsNum = 0;
+	int32 UnpackedBoolsSize = 0;
+	int64 InstancesNum = 0;
+	// Gaps in native types mostly hold members not exposed to reflection, they are reported apart and not counted as waste
+	bool bNative = false;
+	TArray<FGap> Gaps;
+
+	[[nodiscard]] int32 GetVerifiedPadding() const { return bNative ? 0 : PaddingSize; }
+	[[nodiscard]] int32 GetUnverifiedPadding() const { return bNative ? PaddingSize : 0; }
+	[[nodiscard]] int32 GetWasteSize() const { return GetVerifiedPadding() + UnpackedBoolsSize; }
+	[[nodiscard]] int64 GetTotalWaste() const { return GetWasteSize() * InstancesNum; }
+};
+
+static bool IsNativeLayout(const UStruct* Struct)
+{
+	if (const UClass* Class = Cast<UClass>(Struct))
+	{
+		return Class->HasAnyClassFlags(CLASS_Native);
+	}
+	if (const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(Struct))
+	{
+		return (ScriptStruct->StructFlags & STRUCT_Native) != 0;
+	}
+	return false;
+}
+
+// Own layout only, from the end of super struct layout. Inherited gaps are reported on the super struct.
+static FLayoutWaste MeasureLayout(UStruct* Struct)
+{
+	FLayoutWaste Waste;
+	Waste.Struct = Struct;
+	Waste.bNative = IsNativeLayout(Struct);
+
+	TArray<const FProperty*, TInlineAllocator<64>> Properties;
+	for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		Properties.Add(*It);
+	}
+	Properties.Sort([](const FProperty& A, const FProperty& B) { return A.GetOffset_ForInternal() < B.GetOffset_ForInternal(); });
+
+	const UStruct* SuperStruct = Struct->GetSuperStruct();
+	int32 LayoutEnd = SuperStruct != nullptr ? SuperStruct->GetPropertiesSize() : 0;
+	FName PreviousProperty = SuperStruct != nullptr ? SuperStruct->GetFName() : NAME_None;
+
+	for (const FProperty* Property : Properties)
+	{
+		const int32 Offset = Property->GetOffset_ForInternal();
+		if (Offset > LayoutEnd)
+		{
+			Waste.Gaps.Add({PreviousProperty, LayoutEnd, Offset - LayoutEnd});
+			Waste.PaddingSize += Offset - LayoutEnd;
+		}
+
+		// Bitfield bools share bytes, native bools take a byte each
+		if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property); BoolProperty != nullptr && BoolProperty->IsNativeBool())
+		{
+			Waste.NativeBoolsNum += Property->GetArrayDim();
+		}
+
+		LayoutEnd = FMath::Max(LayoutEnd, Offset + Property->GetSize());
+		PreviousProperty = Property->GetFName();
+	}
+
+	// Tail padding up to aligned size
+	if (Struct->GetPropertiesSize() > LayoutEnd && Properties.Num() > 0)
+	{
+		Waste.Gaps.Add({PreviousProperty, LayoutEnd, Struct->GetPropertiesSize() - LayoutEnd});
+		Waste.PaddingSize += Struct->GetPropertiesSize() - LayoutEnd;
+	}
+
+	// Packing all native bools into bitfield would take one byte per 8 bools
+	Waste.UnpackedBoolsSize = Waste.NativeBoolsNum - FMath::DivideAndRoundUp(Waste.NativeBoolsNum, 8);
+	return Waste;
+}
+
+// Structs live inside objects, count every embedded occurrence (static arrays included, dynamic containers not)
+static void AddEmbeddedStructs(const UStruct* Container, const int64 Multiplier, TMap<const UStruct*, int64>& InOutCounts)
+{
+	for (TFieldIterator<FStructProperty> It(Container); It; ++It)
+	{
+		const int64 Count = Multiplier * It->GetArrayDim();
+		InOutCounts.FindOrAdd(It->Struct) += Count;
+		AddEmbeddedStructs(It->Struct, Count, InOutCounts);
+	}
+}
+}
+
+TSharedPtr<FObjectOutlinerReport> AnalyzeLayoutPadding(const TArray<UObject*>& Objects)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(AnalyzeLayoutPadding);
+	using namespace PaddingAnalysis;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Single pass over object array for exact class instance counts
+	TMap<const UStruct*, int64> ExactCounts;
+	for (FThreadSafeObjectIterator It; It; ++It)
+	{
+		ExactCounts.FindOrAdd(It->GetClass())++;
+	}
+
+	// Class layout is part of every subclass instance, struct layout of every embedded struct and its child structs
+	TMap<const UStruct*, int64> InstanceCounts;
+	for (const TPair<const UStruct*, int64>& Pair : ExactCounts)
+	{
+		for (const UStruct* Struct = Pair.Key; Struct != nullptr; Struct = Struct->GetSuperStruct())
+		{
+			InstanceCounts.FindOrAdd(Struct) += Pair.Value;
+		}
+
+		TMap<const UStruct*, int64> EmbeddedCounts;
+		AddEmbeddedStructs(Pair.Key, Pair.Value, EmbeddedCounts);
+		for (const TPair<const UStruct*, int64>& EmbeddedPair : EmbeddedCounts)
+		{
+			for (const UStruct* Struct = EmbeddedPair.Key; Struct != nullptr; Struct = Struct->GetSuperStruct())
+			{
+				InstanceCounts.FindOrAdd(Struct) += EmbeddedPair.Value;
+			}
+		}
+	}
+
+	TArray<FLayoutWaste> Layouts;
+	for (UObject* Object : Objects)
+	{
+		UStruct* Struct = Cast<UStruct>(Object);
+		if (Struct == nullptr || (Struct->IsA<UClass>() == false && Struct->IsA<UScriptStruct>() == false))
+		{
+			continue;
+		}
+
+		FLayoutWaste Waste = MeasureLayout(Struct);
+		if (Waste.GetWasteSize() > 0 || Waste.GetUnverifiedPadding() > 0)
+		{
+			Waste.InstancesNum = InstanceCounts.FindRef(Struct);
+			Layouts.Add(MoveTemp(Waste));
+		}
+	}
+
+	Layouts.Sort([](const FLayoutWaste& A, const FLayoutWaste& B)
+	{
+		if (A.GetTotalWaste() != B.GetTotalWaste())
+		{
+			return A.GetTotalWaste() > B.GetTotalWaste();
+		}
+		return A.GetWasteSize() != B.GetWasteSize() ? A.GetWasteSize() > B.GetWasteSize() : A.GetUnverifiedPadding() * A.InstancesNum > B.GetUnverifiedPadding() * B.InstancesNum;
+	});
+
+	const TSharedRef<FObjectOutlinerReport> Report = MakeShared<FObjectOutlinerReport>(INVTEXT("Layout Padding"));
+	const int32 Column_Name = Report->AddColumn("Name", INVTEXT("Type / Gap After"), EObjectOutlinerReportColumnType::Text, 0.3f);
+	const int32 Column_Size = Report->AddColumn("Size", INVTEXT("Size"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Padding = Report->AddColumn("Padding", INVTEXT("Padding"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Unverified = Report->AddColumn("Unverified", INVTEXT("Native Gaps (Unverified)"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Bools = Report->AddColumn("Bools", INVTEXT("Unpacked Bools"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Instances = Report->AddColumn("Instances", INVTEXT("Instances"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_Waste = Report->AddColumn("Waste", INVTEXT("Wasted Now"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Path = Report->AddColumn("Path", INVTEXT("Path / Offset"), EObjectOutlinerReportColumnType::Text, 0.2f);
+
+	int64 TotalWaste = 0;
+	int64 TotalUnverified = 0;
+	for (const FLayoutWaste& Waste : Layouts)
+	{
+		FObjectOutlinerReportRow& TypeRow = Report->AddRow();
+		TypeRow.SetText(Column_Name, Waste.Struct->GetName());
+		TypeRow.SetValue(Column_Size, Waste.Struct->GetPropertiesSize());
+		TypeRow.SetValue(Column_Padding, Waste.GetVerifiedPadding());
+		TypeRow.SetValue(Column_Unverified, Waste.GetUnverifiedPadding());
+		TypeRow.SetValue(Column_Bools, Waste.UnpackedBoolsSize);
+		TypeRow.SetValue(Column_Instances, Waste.InstancesNum);
+		TypeRow.SetValue(Column_Waste, Waste.GetTotalWaste());
+		TypeRow.SetText(Column_Path, Waste.Struct->GetPathName());
+		TypeRow.Object = Waste.Struct;
+		TypeRow.Tooltip = FString::Printf(TEXT("%d native bools"), Waste.NativeBoolsNum);
+		TotalWaste += Waste.GetTotalWaste();
+		TotalUnverified += Waste.GetUnverifiedPadding() * Waste.InstancesNum;
+
+		for (const FGap& Gap : Waste.Gaps)
+		{
+			FObjectOutlinerReportRow& GapRow = TypeRow.AddChild(Report->Columns.Num());
+			GapRow.SetText(Column_Name, Gap.AfterProperty.ToString());
+			GapRow.SetValue(Waste.bNative ? Column_Unverified : Column_Padding, Gap.Size);
+			GapRow.SetValue(Column_Instances, Waste.InstancesNum);
+			GapRow.SetValue(Column_Waste, Waste.bNative ? 0 : Gap.Size * Waste.InstancesNum);
+			GapRow.SetText(Column_Path, FString::Printf(TEXT("Offset %d"), Gap.Offset));
+		}
+	}
+
+	Report->Summary = FText::Format(
+		INVTEXT("{0} types have padding or unpacked bools, {1} wasted by live instances. Gaps between reflected properties of native types ({2} over live instances) usually hold members not exposed to reflection, they are listed as unverified and not counted as waste."),
+		FText::AsNumber(Layouts.Num()),
+		FText::AsMemory(TotalWaste, IEC),
+		FText::AsMemory(TotalUnverified, IEC));
+
+	UE_LOG(LogHazardTools, Log, TEXT("Layout padding: %d types, analyzed in %.2f s"), Layouts.Num(), FPlatformTime::Seconds() - StartTime);
+
+	return Report;
+}
+}
@@ -0,0 +1,155 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerAnalysis.h"
+#include "HazardTools.h"
+
+namespace HazardTools
+{
+namespace ReflectionAnalysis
+{
+struct FStructFootprint
+{
+	UStruct* Struct = nullptr;
+	int64 PropertiesNum = 0;
+	int64 FunctionsNum = 0;
+	int64 ParamsSize = 0;
+	int64 BytecodeSize = 0;
+	int64 Memory = 0;
+
+	FStructFootprint& operator+=(const FStructFootprint& Other)
+	{
+		PropertiesNum += Other.PropertiesNum;
+		FunctionsNum += Other.FunctionsNum;
+		ParamsSize += Other.ParamsSize;
+		BytecodeSize += Other.BytecodeSize;
+		Memory += Other.Memory;
+		return *this;
+	}
+};
+
+struct FGroupFootprint
+{
+	FStructFootprint Total;
+	TArray<FStructFootprint> Structs;
+	bool bIsModule = false;
+};
+
+// Own fields only, inherited ones are counted on their super struct
+static FStructFootprint MeasureStruct(UStruct* Struct)
+{
+	FStructFootprint Footprint;
+	Footprint.Struct = Struct;
+	Footprint.Memory = Struct->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+	Footprint.BytecodeSize = Struct->Script.Num();
+
+	for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		Footprint.PropertiesNum++;
+	}
+
+	// Functions are nested in their class, parameters and locals are properties of the function
+	for (TFieldIterator<UFunction> It(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		const UFunction* Function = *It;
+		Footprint.FunctionsNum++;
+		Footprint.ParamsSize += Function->ParmsSize;
+		Footprint.BytecodeSize += Function->Script.Num();
+		Footprint.Memory += Function->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+		for (TFieldIterator<FProperty> PropertyIt(Function, EFieldIteratorFlags::ExcludeSuper); PropertyIt; ++PropertyIt)
+		{
+			Footprint.PropertiesNum++;
+		}
+	}
+	return Footprint;
+}
+}
+
+TSharedPtr<FObjectOutlinerReport> AnalyzeReflectionFootprint(const TArray<UObject*>& Objects)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(AnalyzeReflectionFootprint);
+	using namespace ReflectionAnalysis;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Native types are grouped by module (/Script/ package), blueprints and user structs by their asset package
+	TMap<UPackage*, FGroupFootprint> Groups;
+	FStructFootprint Total;
+	int32 StructsNum = 0;
+	for (UObject* Object : Objects)
+	{
+		UStruct* Struct = Cast<UStruct>(Object);
+		if (Struct == nullptr || Struct->IsA<UFunction>())
+		{
+			continue; // Functions are measured as part of their owning class
+		}
+
+		UPackage* Package = Struct->GetOutermost();
+		FGroupFootprint& Group = Groups.FindOrAdd(Package);
+		Group.bIsModule = Package->HasAnyPackageFlags(PKG_CompiledIn);
+
+		const FStructFootprint& Footprint = Group.Structs.Add_GetRef(MeasureStruct(Struct));
+		Group.Total += Footprint;
+		Total += Footprint;
+		StructsNum++;
+	}
+
+	Groups.ValueSort([](const FGroupFootprint& A, const FGroupFootprint& B) { return A.Total.Memory + A.Total.BytecodeSize > B.Total.Memory + B.Total.BytecodeSize; });
+
+	const TSharedRef<FObjectOutlinerReport> Report = MakeShared<FObjectOutlinerReport>(INVTEXT("Reflection and Bytecode Footprint"));
+	const int32 Column_Name = Report->AddColumn("Name", INVTEXT("Module / Blueprint / Type"), EObjectOutlinerReportColumnType::Text, 0.35f);
+	const int32 Column_Kind = Report->AddColumn("Kind", INVTEXT("Kind"), EObjectOutlinerReportColumnType::Text, 0.1f);
+	const int32 Column_Properties = Report->AddColumn("Properties", INVTEXT("Properties"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_Functions = Report->AddColumn("Functions", INVTEXT("Functions"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_Params = Report->AddColumn("Params", INVTEXT("Params Size"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Bytecode = Report->AddColumn("Bytecode", INVTEXT("Bytecode"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Memory = Report->AddColumn("Memory", INVTEXT("Memory"), EObjectOutlinerReportColumnType::Memory, 0.15f);
+
+	const auto FillRow = [&](FObjectOutlinerReportRow& Row, const FStructFootprint& Footprint)
+	{
+		Row.SetValue(Column_Properties, Footprint.PropertiesNum);
+		Row.SetValue(Column_Functions, Footprint.FunctionsNum);
+		Row.SetValue(Column_Params, Footprint.ParamsSize);
+		Row.SetValue(Column_Bytecode, Footprint.BytecodeSize);
+		Row.SetValue(Column_Memory, Footprint.Memory);
+	};
+
+	for (TPair<UPackage*, FGroupFootprint>& Pair : Groups)
+	{
+		FString GroupName = Pair.Key->GetName();
+		if (Pair.Value.bIsModule)
+		{
+			GroupName.RemoveFromStart(TEXT("/Script/"));
+		}
+
+		FObjectOutlinerReportRow& GroupRow = Report->AddRow();
+		GroupRow.SetText(Column_Name, GroupName);
+		GroupRow.SetText(Column_Kind, Pair.Value.bIsModule ? TEXT("Module") : TEXT("Asset"));
+		GroupRow.Object = Pair.Key;
+		FillRow(GroupRow, Pair.Value.Total);
+
+		Pair.Value.Structs.Sort([](const FStructFootprint& A, const FStructFootprint& B) { return A.BytecodeSize != B.BytecodeSize ? A.BytecodeSize > B.BytecodeSize : A.Memory > B.Memory; });
+		for (const FStructFootprint& Footprint : Pair.Value.Structs)
+		{
+			FObjectOutlinerReportRow& StructRow = GroupRow.AddChild(Report->Columns.Num());
+			StructRow.SetText(Column_Name, Footprint.Struct->GetName());
+			StructRow.SetText(Column_Kind, Footprint.Struct->GetClass()->GetName());
+			StructRow.Object = Footprint.Struct;
+			StructRow.Tooltip = Footprint.Struct->GetPathName();
+			FillRow(StructRow, Footprint);
+		}
+	}
+
+	Report->Summary = FText::Format(
+		INVTEXT("{0} types in {1} modules and assets: {2} properties, {3} functions, {4} of bytecode, {5} of reflection objects."),
+		FText::AsNumber(StructsNum),
+		FText::AsNumber(Groups.Num()),
+		FText::AsNumber(Total.PropertiesNum),
+		FText::AsNumber(Total.FunctionsNum),
+		FText::AsMemory(Total.BytecodeSize, IEC),
+		FText::AsMemory(Total.Memory, IEC));
+
+	UE_LOG(LogHazardTools, Log, TEXT("Reflection footprint: %d types, analyzed in %.2f s"), StructsNum, FPlatformTime::Seconds() - StartTime);
+
+	return Report;
+}
+}
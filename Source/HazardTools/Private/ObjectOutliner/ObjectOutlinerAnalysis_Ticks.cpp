@@ -0,0 +1,193 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerAnalysis.h"
+#include "HazardTools.h"
+#include "HazardToolsObjectOutlinerSettings.h"
+#include "ObjectOutlinerReport.h"
+#include "ObjectOutlinerTickSampler.h"
+#include "Components/ActorComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Subsystems/WorldSubsystem.h"
+
+namespace HazardTools
+{
+namespace TicksAnalysis
+{
+struct FTickOwner
+{
+	FObjectOutlinerTickSampler::FTickFunctionInfo Info;
+	FString Name;
+	FString Kind;
+	FString TickGroup;
+	float TickInterval = 0.f;
+	bool bEnabled = false;
+	bool bTickWhenPaused = false;
+	// Negative until a frame was sampled
+	int32 EnabledPercent = INDEX_NONE;
+};
+
+struct FWorldTicks
+{
+	UWorld* World = nullptr;
+	TArray<FTickOwner> Owners;
+	int32 EnabledNum = 0;
+};
+
+static FString GetTickGroupName(const ETickingGroup TickGroup)
+{
+	FString Name = StaticEnum<ETickingGroup>()->GetNameStringByValue(TickGroup);
+	Name.RemoveFromStart(TEXT("TG_"));
+	return Name;
+}
+
+static FTickOwner MakeTickOwner(const FObjectOutlinerTickSampler& Sampler, const FObjectOutlinerTickSampler::FTickFunctionInfo& Info)
+{
+	FTickOwner TickOwner;
+	TickOwner.Info = Info;
+	TickOwner.Name = Info.Owner->GetName();
+	TickOwner.bEnabled = FObjectOutlinerTickSampler::IsTickEnabled(Info);
+
+	if (const FTickFunction* TickFunction = Info.Function)
+	{
+		// Secondary tick functions, e.g. pre physics tick of movement component, are listed with their property name
+		if (Info.Name != GET_MEMBER_NAME_CHECKED(AActor, PrimaryActorTick) && Info.Name != GET_MEMBER_NAME_CHECKED(UActorComponent, PrimaryComponentTick))
+		{
+			TickOwner.Name += TEXT(".") + Info.Name.ToString();
+		}
+		TickOwner.Kind = Info.Owner->IsA<AActor>() ? TEXT("Actor") : TEXT("Component");
+		TickOwner.TickGroup = GetTickGroupName(TickFunction->TickGroup);
+		if (TickFunction->EndTickGroup > TickFunction->TickGroup)
+		{
+			TickOwner.TickGroup += TEXT(" - ") + GetTickGroupName(TickFunction->EndTickGroup);
+		}
+		TickOwner.TickInterval = TickFunction->TickInterval;
+		TickOwner.bTickWhenPaused = TickFunction->bTickEvenWhenPaused;
+	}
+	else
+	{
+		// Tickable objects tick after all tick groups, once per frame
+		const FTickableGameObject* Tickable = CastChecked<UTickableWorldSubsystem>(Info.Owner);
+		TickOwner.Kind = TEXT("Subsystem");
+		TickOwner.TickGroup = TEXT("Tickable Objects");
+		TickOwner.bTickWhenPaused = Tickable->IsTickableWhenPaused();
+	}
+
+	const FObjectOutlinerTickSampler::FCounts Counts = Sampler.GetCounts(Info);
+	if (Counts.SampledFrames > 0)
+	{
+		TickOwner.EnabledPercent = FMath::RoundToInt(100.0 * Counts.EnabledFrames / Counts.SampledFrames);
+	}
+	return TickOwner;
+}
+}
+
+TSharedPtr<FObjectOutlinerReport> AnalyzeTickFunctions(const TArray<UObject*>& Objects)
+{
+	using namespace TicksAnalysis;
+	TRACE_CPUPROFILER_EVENT_SCOPE(AnalyzeTickFunctions);
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Whole worlds of displayed objects are listed, tick functions are registered per level and not per displayed object
+	TSet<UWorld*> Worlds;
+	for (const UObject* Object : Objects)
+	{
+		if (UWorld* World = Object->GetWorld())
+		{
+			Worlds.Add(World);
+		}
+	}
+
+	FObjectOutlinerTickSampler& Sampler = FObjectOutlinerTickSampler::Get();
+	TArray<FObjectOutlinerTickSampler::FTickFunctionInfo> TickFunctions;
+	for (UWorld* World : Worlds)
+	{
+		FObjectOutlinerTickSampler::GetTickFunctions(World, TickFunctions);
+	}
+	Sampler.Track(TickFunctions);
+
+	TMap<UWorld*, FWorldTicks> WorldTicksMap;
+	int32 EnabledNum = 0;
+	for (const FObjectOutlinerTickSampler::FTickFunctionInfo& Info : TickFunctions)
+	{
+		FTickOwner TickOwner = MakeTickOwner(Sampler, Info);
+
+		FWorldTicks& WorldTicks = WorldTicksMap.FindOrAdd(Info.Owner->GetWorld());
+		WorldTicks.World = Info.Owner->GetWorld();
+		WorldTicks.EnabledNum += TickOwner.bEnabled ? 1 : 0;
+		EnabledNum += TickOwner.bEnabled ? 1 : 0;
+		WorldTicks.Owners.Add(MoveTemp(TickOwner));
+	}
+
+	TArray<FWorldTicks> SortedWorlds;
+	WorldTicksMap.GenerateValueArray(SortedWorlds);
+	SortedWorlds.Sort([](const FWorldTicks& A, const FWorldTicks& B) { return A.EnabledNum > B.EnabledNum; });
+
+	const TSharedRef<FObjectOutlinerReport> Report = MakeShared<FObjectOutlinerReport>(INVTEXT("Tick Functions"));
+	const int32 Column_Name = Report->AddColumn("Name", INVTEXT("World / Owner"), EObjectOutlinerReportColumnType::Text, 0.28f);
+	const int32 Column_Kind = Report->AddColumn("Kind", INVTEXT("Kind"), EObjectOutlinerReportColumnType::Text, 0.08f);
+	const int32 Column_Group = Report->AddColumn("TickGroup", INVTEXT("Tick Group"), EObjectOutlinerReportColumnType::Text, 0.12f);
+	const int32 Column_Interval = Report->AddColumn("Interval", INVTEXT("Interval"), EObjectOutlinerReportColumnType::Text, 0.08f);
+	const int32 Column_Enabled = Report->AddColumn("Enabled", INVTEXT("Enabled"), EObjectOutlinerReportColumnType::Number, 0.07f);
+	const int32 Column_Paused = Report->AddColumn("Paused", INVTEXT("When Paused"), EObjectOutlinerReportColumnType::Text, 0.07f);
+	const int32 Column_Percent = Report->AddColumn("EnabledFrames", INVTEXT("Enabled Frames %"), EObjectOutlinerReportColumnType::Number, 0.09f);
+	const int32 Column_Class = Report->AddColumn("Class", INVTEXT("Class"), EObjectOutlinerReportColumnType::Text, 0.12f);
+
+	int32 AlwaysTickingNum = 0;
+	for (FWorldTicks& WorldTicks : SortedWorlds)
+	{
+		WorldTicks.Owners.Sort([](const FTickOwner& A, const FTickOwner& B) { return A.EnabledPercent != B.EnabledPercent ? A.EnabledPercent > B.EnabledPercent : A.Name < B.Name; });
+
+		FObjectOutlinerReportRow& WorldRow = Report->AddRow();
+		WorldRow.SetText(Column_Name, WorldTicks.World ? WorldTicks.World->GetName() : TEXT("No World"));
+		WorldRow.SetText(Column_Kind, FString::Printf(TEXT("%d functions"), WorldTicks.Owners.Num()));
+		WorldRow.SetValue(Column_Enabled, WorldTicks.EnabledNum);
+		WorldRow.Object = WorldTicks.World;
+		WorldRow.Tooltip = TEXT("Registered tick functions of actors and components in the world, and its tickable world subsystems");
+
+		for (const FTickOwner& TickOwner : WorldTicks.Owners)
+		{
+			FObjectOutlinerReportRow& OwnerRow = WorldRow.AddChild(Report->Columns.Num());
+			OwnerRow.SetText(Column_Name, TickOwner.Name);
+			OwnerRow.SetText(Column_Kind, TickOwner.Kind);
+			OwnerRow.SetText(Column_Group, TickOwner.TickGroup);
+			OwnerRow.SetText(Column_Interval, TickOwner.TickInterval > 0.f ? FString::Printf(TEXT("%.3f s"), TickOwner.TickInterval) : TEXT("Every frame"));
+			OwnerRow.SetValue(Column_Enabled, TickOwner.bEnabled ? 1 : 0);
+			OwnerRow.SetText(Column_Paused, TickOwner.bTickWhenPaused ? TEXT("Yes") : TEXT("No"));
+			OwnerRow.SetValue(Column_Percent, TickOwner.EnabledPercent);
+			OwnerRow.SetText(Column_Class, TickOwner.Info.Owner->GetClass()->GetName());
+			OwnerRow.Tooltip = TickOwner.Info.Owner->GetPathName();
+			OwnerRow.Object = TickOwner.Info.Owner;
+
+			// First report of a session comes before any frame was sampled, enabled frames are unknown until refreshed
+			if (TickOwner.EnabledPercent < 0)
+			{
+				OwnerRow.SetText(Column_Percent, TEXT("n/a"));
+				OwnerRow.Tooltip += TEXT("\nEnabled frames: n/a, not sampled yet, refresh the report after a few frames");
+			}
+
+			// Ticked on every sampled frame without interval, first candidates to disable or slow down
+			OwnerRow.bHighlight = TickOwner.EnabledPercent == 100 && TickOwner.TickInterval <= 0.f;
+			AlwaysTickingNum += OwnerRow.bHighlight ? 1 : 0;
+		}
+	}
+
+	const FText SamplingText = Sampler.HasCompleteWindow()
+		? FText::Format(INVTEXT("Sampled over last {0} frames."), FText::AsNumber(UHazardToolsObjectOutlinerSettings::Get().TickSampleFrames))
+		: Sampler.GetCurrentWindowFrames() == 0
+		? INVTEXT("Sampling just started, enabled frames show n/a until the report is refreshed.")
+		: FText::Format(INVTEXT("Sampling in progress ({0} of {1} frames), refresh the report to update."), FText::AsNumber(Sampler.GetCurrentWindowFrames()), FText::AsNumber(UHazardToolsObjectOutlinerSettings::Get().TickSampleFrames));
+
+	Report->Summary = FText::Format(
+		INVTEXT("{0} registered tick functions in {1} worlds, {2} enabled, {3} tick every frame. {4}"),
+		FText::AsNumber(TickFunctions.Num()),
+		FText::AsNumber(SortedWorlds.Num()),
+		FText::AsNumber(EnabledNum),
+		FText::AsNumber(AlwaysTickingNum),
+		SamplingText);
+
+	UE_LOG(LogHazardTools, Log, TEXT("Tick functions: %d functions in %d worlds, analyzed in %.2f s"), TickFunctions.Num(), SortedWorlds.Num(), FPlatformTime::Seconds() - StartTime);
+
+	return Report;
+}
+}
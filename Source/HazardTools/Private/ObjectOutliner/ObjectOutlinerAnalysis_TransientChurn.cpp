@@ -0,0 +1,22 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerAnalysis.h"
+#include "ObjectOutlinerReport.h"
+#include "ObjectOutlinerTransientChurn.h"
+
+namespace HazardTools
+{
+TSharedPtr<FObjectOutlinerReport> AnalyzeTransientChurn(const TArray<UObject*>& /*Objects*/)
+{
+	// Displayed objects are not used: counters cover the whole transient package since startup, including objects
+	// which were already destroyed and classes which have no live instance to display
+	if (FObjectOutlinerTransientChurn* TransientChurn = FObjectOutlinerTransientChurn::Get())
+	{
+		return TransientChurn->MakeReport();
+	}
+
+	const TSharedPtr<FObjectOutlinerReport> Report = MakeShared<FObjectOutlinerReport>(INVTEXT("Transient Package Churn"));
+	Report->Summary = INVTEXT("Population tracking is disabled in Object Outliner settings, enable it and restart the editor to collect transient churn.");
+	return Report;
+}
+}
@@ -0,0 +1,268 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerBatchActions.h"
+
+#include "AssetViewUtils.h"
+#include "HazardTools.h"
+#include "HazardToolsObjectOutlinerSettings.h"
+#include "HazardToolsUtils.h"
+#include "ObjectOutlinerExport.h"
+#include "ObjectOutlinerWatchList.h"
+#include "Editor.h"
+#include "Async/Async.h"
+#include "Components/ActorComponent.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "GameFramework/Actor.h"
+#include "Misc/MessageDialog.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "UObject/GCScopeLock.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+namespace HazardTools
+{
+namespace BatchActions
+{
+// Opening more editors than this at once asks for confirmation
+constexpr int32 OpenEditorsConfirmNum = 10;
+
+static TSharedPtr<SNotificationItem> AddPendingNotification(const FText& Text)
+{
+	FNotificationInfo Info(Text);
+	Info.bFireAndForget = false;
+	Info.ExpireDuration = 5.0f;
+	TSharedPtr<SNotificationItem> NotificationItem = FSlateNotificationManager::Get().AddNotification(Info);
+	if (NotificationItem.IsValid())
+	{
+		NotificationItem->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+	return NotificationItem;
+}
+
+static void CompleteNotification(const TSharedPtr<SNotificationItem>& NotificationItem, const FText& Text)
+{
+	if (NotificationItem.IsValid())
+	{
+		NotificationItem->SetText(Text);
+		NotificationItem->SetCompletionState(SNotificationItem::CS_Success);
+		NotificationItem->ExpireAndFadeout();
+	}
+}
+}
+
+void FObjectOutlinerBatchActions::CopyPathsAsync(TArray<TWeakObjectPtr<UObject>>&& Objects)
+{
+	check(IsInGameThread());
+
+	if (Objects.Num() == 1)
+	{
+		if (const UObject* Object = Objects[0].Get())
+		{
+			FHazardToolsUtils::SetClipboardText(Object->GetPathName());
+		}
+		return;
+	}
+
+	TSharedPtr<SNotificationItem> NotificationItem = BatchActions::AddPendingNotification(FText::Format(INVTEXT("Copying {0} object paths..."), FText::AsNumber(Objects.Num())));
+
+	Async(EAsyncExecution::Thread, [Objects = MoveTemp(Objects), NotificationItem]()
+	{
+		FString ClipboardText;
+		ClipboardText.Reserve(Objects.Num() * 96);
+
+		// Same bounded GC blocking as export
+		constexpr int32 RowsPerGCGuard = 4096;
+		for (int32 ChunkStart = 0; ChunkStart < Objects.Num(); ChunkStart += RowsPerGCGuard)
+		{
+			FGCScopeGuard GCGuard;
+
+			const int32 ChunkEnd = FMath::Min(ChunkStart + RowsPerGCGuard, Objects.Num());
+			for (int32 Index = ChunkStart; Index < ChunkEnd; ++Index)
+			{
+				if (const UObject* Object = Objects[Index].Get())
+				{
+					if (ClipboardText.IsEmpty() == false)
+					{
+						ClipboardText.AppendChar(TEXT('\n'));
+					}
+					Object->GetPathName(nullptr, ClipboardText);
+				}
+			}
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [ClipboardText = MoveTemp(ClipboardText), NotificationItem]()
+		{
+			if (NotificationItem.IsValid())
+			{
+				NotificationItem->ExpireAndFadeout();
+			}
+			FHazardToolsUtils::SetClipboardText(ClipboardText);
+		});
+	});
+}
+
+void FObjectOutlinerBatchActions::ExportAsync(TArray<TWeakObjectPtr<UObject>>&& Objects)
+{
+	FString Filename;
+	EObjectOutlinerExportFormat Format;
+	if (FObjectOutlinerExporter::PickExportFilename(nullptr, Filename, Format))
+	{
+		FObjectOutlinerExporter::ExportAsync(MoveTemp(Objects), Filename, Format);
+	}
+}
+
+void FObjectOutlinerBatchActions::OpenEditors(TArray<TWeakObjectPtr<UObject>>&& Objects)
+{
+	if (Objects.Num() > BatchActions::OpenEditorsConfirmNum)
+	{
+		const FText Message = FText::Format(INVTEXT("Open editors for {0} objects?"), FText::AsNumber(Objects.Num()));
+		if (FMessageDialog::Open(EAppMsgType::YesNo, Message) != EAppReturnType::Yes)
+		{
+			return;
+		}
+	}
+
+	RunTimeSliced(INVTEXT("Opening editors"), MoveTemp(Objects), [](UObject& Object)
+	{
+		return AssetViewUtils::OpenEditorForAsset(&Object);
+	});
+}
+
+bool FObjectOutlinerBatchActions::CanMarkAsGarbage(const UObject* Object)
+{
+	if (IsValid(Object) == false
+	    || Object->IsRooted()
+	    || Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject)
+	    || Object->IsA<UField>()
+	    || Object->IsA<UPackage>())
+	{
+		return false;
+	}
+
+	// Open asset editor keeps working on the asset and would crash or resurrect it
+	if (Object->HasAnyFlags(RF_Standalone) && GEditor != nullptr)
+	{
+		if (UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
+		{
+			if (AssetEditorSubsystem->FindEditorForAsset(const_cast<UObject*>(Object), false) != nullptr)
+			{
+				return false;
+			}
+		}
+	}
+
+	if (const AActor* Actor = Cast<AActor>(Object))
+	{
+		return Actor->GetWorld() != nullptr;
+	}
+	return true;
+}
+
+void FObjectOutlinerBatchActions::MarkAsGarbage(TArray<TWeakObjectPtr<UObject>>&& Objects)
+{
+	const FText Message = FText::Format(
+		INVTEXT("Mark {0} objects as garbage? Actors and components are destroyed, other objects will be destroyed by next garbage collection and references to them will be cleared. This can't be undone."),
+		FText::AsNumber(Objects.Num()));
+	if (FMessageDialog::Open(EAppMsgType::YesNo, Message) != EAppReturnType::Yes)
+	{
+		return;
+	}
+
+	RunTimeSliced(INVTEXT("Marking as garbage"), MoveTemp(Objects), [](UObject& Object)
+	{
+		if (CanMarkAsGarbage(&Object) == false)
+		{
+			return false;
+		}
+
+		// Live actors and components have to be unregistered and detached first, their own destroy path does that and marks them
+		if (AActor* Actor = Cast<AActor>(&Object))
+		{
+			UWorld* World = Actor->GetWorld();
+			return World->IsGameWorld() ? World->DestroyActor(Actor) : World->EditorDestroyActor(Actor, true);
+		}
+		if (UActorComponent* Component = Cast<UActorComponent>(&Object))
+		{
+			Component->DestroyComponent();
+			return true;
+		}
+
+		Object.MarkAsGarbage();
+		return true;
+	});
+}
+
+void FObjectOutlinerBatchActions::AddToWatchList(TArray<TWeakObjectPtr<UObject>>&& Objects)
+{
+	RunTimeSliced(INVTEXT("Adding to watch list"), MoveTemp(Objects), [](UObject& Object)
+	{
+		if (FObjectOutlinerWatchList::Get().Contains(&Object))
+		{
+			return false;
+		}
+		FObjectOutlinerWatchList::Get().Add(&Object);
+		return true;
+	});
+}
+
+void FObjectOutlinerBatchActions::RunTimeSliced(const FText& Title, TArray<TWeakObjectPtr<UObject>>&& Objects, TFunction<bool(UObject& Object)> Action)
+{
+	check(IsInGameThread());
+
+	if (Objects.Num() == 0)
+	{
+		return;
+	}
+
+	struct FState
+	{
+		TArray<TWeakObjectPtr<UObject>> Objects;
+		TFunction<bool(UObject&)> Action;
+		TSharedPtr<SNotificationItem> NotificationItem;
+		FText Title;
+		int32 NextIndex = 0;
+		int32 AppliedNum = 0;
+		double StartTime = 0.0;
+	};
+
+	const TSharedRef<FState> State = MakeShared<FState>();
+	State->Objects = MoveTemp(Objects);
+	State->Action = MoveTemp(Action);
+	State->Title = Title;
+	State->StartTime = FPlatformTime::Seconds();
+	State->NotificationItem = BatchActions::AddPendingNotification(FText::Format(INVTEXT("{0}: 0 / {1}"), Title, FText::AsNumber(State->Objects.Num())));
+
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([State](float /*DeltaTime*/)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerBatchActions::RunTimeSliced);
+
+		// At least one object per frame, single action may take longer than the budget
+		const double EndTime = FPlatformTime::Seconds() + UHazardToolsObjectOutlinerSettings::Get().BatchActionBudgetMs / 1000.0;
+		do
+		{
+			if (UObject* Object = State->Objects[State->NextIndex].Get())
+			{
+				State->AppliedNum += State->Action(*Object) ? 1 : 0;
+			}
+			State->NextIndex++;
+		}
+		while (State->NextIndex < State->Objects.Num() && FPlatformTime::Seconds() < EndTime);
+
+		if (State->NextIndex < State->Objects.Num())
+		{
+			if (State->NotificationItem.IsValid())
+			{
+				State->NotificationItem->SetText(FText::Format(INVTEXT("{0}: {1} / {2}"), State->Title, FText::AsNumber(State->NextIndex), FText::AsNumber(State->Objects.Num())));
+			}
+			return true; // Keep ticking
+		}
+
+		const double ElapsedSeconds = FPlatformTime::Seconds() - State->StartTime;
+		UE_LOG(LogHazardTools, Log, TEXT("%s: %d of %d objects in %.2f s"), *State->Title.ToString(), State->AppliedNum, State->Objects.Num(), ElapsedSeconds);
+		BatchActions::CompleteNotification(State->NotificationItem,
+			FText::Format(INVTEXT("{0}: done for {1} of {2} objects"), State->Title, FText::AsNumber(State->AppliedNum), FText::AsNumber(State->Objects.Num())));
+		return false;
+	}));
+}
+}
@@ -0,0 +1,36 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace HazardTools
+{
+/**
+ * Actions over many selected outliner objects. Selection is snapshotted as weak pointers,
+ * read only work runs on a worker in GC guarded chunks, game thread only work is time sliced with BatchActionBudgetMs per frame.
+ * Progress and result are reported with a notification.
+ */
+class FObjectOutlinerBatchActions
+{
+public:
+	// Object paths separated by new lines, written to clipboard once when all are formatted
+	static void CopyPathsAsync(TArray<TWeakObjectPtr<UObject>>&& Objects);
+
+	static void ExportAsync(TArray<TWeakObjectPtr<UObject>>&& Objects);
+
+	// Asks for confirmation when there are many objects
+	static void OpenEditors(TArray<TWeakObjectPtr<UObject>>&& Objects);
+
+	// Marked objects are destroyed by next garbage collection, actors and components go through their destroy functions.
+	// Rooted objects, defaults, reflection types and assets open in an editor are skipped
+	static void MarkAsGarbage(TArray<TWeakObjectPtr<UObject>>&& Objects);
+	[[nodiscard]] static bool CanMarkAsGarbage(const UObject* Object);
+
+	static void AddToWatchList(TArray<TWeakObjectPtr<UObject>>&& Objects);
+
+private:
+	// Run Action for every still alive object on game thread, spread over frames
+	static void RunTimeSliced(const FText& Title, TArray<TWeakObjectPtr<UObject>>&& Objects, TFunction<bool(UObject& Object)> Action);
+};
+}
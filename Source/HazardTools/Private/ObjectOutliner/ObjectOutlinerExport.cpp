@@ -0,0 +1,326 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerExport.h"
+
+#include "DesktopPlatformModule.h"
+#include "HazardTools.h"
+#include "IDesktopPlatform.h"
+#include "Async/Async.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "UObject/GCScopeLock.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+namespace HazardTools
+{
+FObjectOutlinerTextFileWriter::FObjectOutlinerTextFileWriter(const FString& InFilename)
+	: FileWriter(IFileManager::Get().CreateFileWriter(*InFilename))
+{
+}
+
+FObjectOutlinerTextFileWriter::~FObjectOutlinerTextFileWriter()
+{
+	Close();
+}
+
+void FObjectOutlinerTextFileWriter::MaybeFlush()
+{
+	if (Buffer.Len() >= FlushThreshold)
+	{
+		Flush();
+	}
+}
+
+void FObjectOutlinerTextFileWriter::Close()
+{
+	if (FileWriter.IsValid())
+	{
+		Flush();
+		FileWriter->Close();
+		FileWriter.Reset();
+	}
+}
+
+void FObjectOutlinerTextFileWriter::Flush()
+{
+	if (FileWriter.IsValid() && Buffer.Len() > 0)
+	{
+		const FTCHARToUTF8 Converted(Buffer.GetData(), Buffer.Len());
+		FileWriter->Serialize(const_cast<ANSICHAR*>(Converted.Get()), Converted.Length());
+	}
+	// Reset keeps allocated capacity, so steady state writing does not allocate
+	Buffer.Reset();
+}
+
+void FObjectOutlinerTextFileWriter::AppendCsvField(FStringBuilderBase& Builder, const FStringView Value)
+{
+	int32 SpecialCharIndex = INDEX_NONE;
+	for (int32 i = 0; i < Value.Len(); ++i)
+	{
+		const TCHAR Char = Value[i];
+		if (Char == TEXT(',') || Char == TEXT('"') || Char == TEXT('\n') || Char == TEXT('\r'))
+		{
+			SpecialCharIndex = i;
+			break;
+		}
+	}
+
+	if (SpecialCharIndex == INDEX_NONE)
+	{
+		Builder.Append(Value);
+		return;
+	}
+
+	Builder.AppendChar(TEXT('"'));
+	for (const TCHAR Char : Value)
+	{
+		if (Char == TEXT('"'))
+		{
+			Builder.AppendChar(TEXT('"'));
+		}
+		Builder.AppendChar(Char);
+	}
+	Builder.AppendChar(TEXT('"'));
+}
+
+void FObjectOutlinerTextFileWriter::AppendJsonString(FStringBuilderBase& Builder, const FStringView Value)
+{
+	Builder.AppendChar(TEXT('"'));
+	for (const TCHAR Char : Value)
+	{
+		switch (Char)
+		{
+			case TEXT('"'):
+				Builder.Append(TEXT("\\\""));
+				break;
+			case TEXT('\\'):
+				Builder.Append(TEXT("\\\\"));
+				break;
+			case TEXT('\n'):
+				Builder.Append(TEXT("\\n"));
+				break;
+			case TEXT('\r'):
+				Builder.Append(TEXT("\\r"));
+				break;
+			case TEXT('\t'):
+				Builder.Append(TEXT("\\t"));
+				break;
+			default:
+				if (Char < 0x20)
+				{
+					Builder.Appendf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+				}
+				else
+				{
+					Builder.AppendChar(Char);
+				}
+		}
+	}
+	Builder.AppendChar(TEXT('"'));
+}
+
+bool FObjectOutlinerExporter::PickExportFilename(const TSharedPtr<const SWidget>& ParentWidget, FString& OutFilename, EObjectOutlinerExportFormat& OutFormat)
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (DesktopPlatform == nullptr)
+	{
+		return false;
+	}
+
+	const void* ParentWindowHandle = FSlateApplication::Get().FindBestParentWindowHandleForDialogs(ParentWidget);
+
+	TArray<FString> OutFilenames;
+	const bool bPicked = DesktopPlatform->SaveFileDialog(
+		ParentWindowHandle,
+		TEXT("Export Object Outliner View"),
+		FPaths::ProjectSavedDir(),
+		TEXT("ObjectOutliner.csv"),
+		TEXT("CSV file (*.csv)|*.csv|JSON file (*.json)|*.json"),
+		EFileDialogFlags::None,
+		OutFilenames);
+
+	if (bPicked == false || OutFilenames.Num() == 0)
+	{
+		return false;
+	}
+
+	OutFilename = OutFilenames[0];
+	OutFormat = FPaths::GetExtension(OutFilename).Equals(TEXT("json"), ESearchCase::IgnoreCase) ? EObjectOutlinerExportFormat::Json : EObjectOutlinerExportFormat::Csv;
+	return true;
+}
+
+void FObjectOutlinerExporter::ExportAsync(TArray<TWeakObjectPtr<UObject>>&& Objects, const FString& Filename, const EObjectOutlinerExportFormat Format)
+{
+	check(IsInGameThread());
+
+	FNotificationInfo Info(FText::Format(INVTEXT("Exporting {0} objects..."), FText::AsNumber(Objects.Num())));
+	Info.bFireAndForget = false;
+	Info.ExpireDuration = 5.0f;
+	TSharedPtr<SNotificationItem> NotificationItem = FSlateNotificationManager::Get().AddNotification(Info);
+	if (NotificationItem.IsValid())
+	{
+		NotificationItem->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	TArray<uint64> ExclusiveSizes;
+	ExclusiveSizes.SetNumUninitialized(Objects.Num());
+	for (int32 Index = 0; Index < Objects.Num(); ++Index)
+	{
+		UObject* Object = Objects[Index].Get();
+		ExclusiveSizes[Index] = Object ? Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive) : 0;
+	}
+
+	Async(EAsyncExecution::Thread, [Objects = MoveTemp(Objects), ExclusiveSizes = MoveTemp(ExclusiveSizes), Filename, Format, NotificationItem]()
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		int32 WrittenNum = 0;
+		bool bSuccess = false;
+
+		{
+			FObjectOutlinerTextFileWriter Writer(Filename);
+			if (Writer.IsOpen())
+			{
+				FStringBuilderBase& Builder = Writer.GetBuilder();
+
+				if (Format == EObjectOutlinerExportFormat::Csv)
+				{
+					AppendCsvHeader(Builder);
+				}
+				else
+				{
+					Builder.Append(TEXT("["));
+				}
+
+				// Keep GC blocked only for a bounded chunk of rows, so a long export never stalls the game thread for long
+				constexpr int32 RowsPerGCGuard = 4096;
+				for (int32 ChunkStart = 0; ChunkStart < Objects.Num(); ChunkStart += RowsPerGCGuard)
+				{
+					FGCScopeGuard GCGuard;
+
+					const int32 ChunkEnd = FMath::Min(ChunkStart + RowsPerGCGuard, Objects.Num());
+					for (int32 Index = ChunkStart; Index < ChunkEnd; ++Index)
+					{
+						const UObject* Object = Objects[Index].Get();
+						if (Object == nullptr)
+						{
+							continue; // Collected since snapshot was taken
+						}
+
+						if (Format == EObjectOutlinerExportFormat::Csv)
+						{
+							AppendCsvRow(Builder, *Object, ExclusiveSizes[Index]);
+						}
+						else
+						{
+							Builder.Append(WrittenNum > 0 ? TEXT(",\n") : TEXT("\n"));
+							AppendJsonRow(Builder, *Object, ExclusiveSizes[Index]);
+						}
+
+						WrittenNum++;
+						Writer.MaybeFlush();
+					}
+				}
+
+				if (Format == EObjectOutlinerExportFormat::Json)
+				{
+					Builder.Append(TEXT("\n]\n"));
+				}
+
+				Writer.Close();
+				bSuccess = true;
+			}
+		}
+
+		const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+		UE_LOG(LogHazardTools, Log, TEXT("Object Outliner export: %d rows written to %s in %.2f s"), WrittenNum, *Filename, ElapsedSeconds);
+
+		AsyncTask(ENamedThreads::GameThread, [NotificationItem, Filename, WrittenNum, ElapsedSeconds, bSuccess]()
+		{
+			if (NotificationItem.IsValid())
+			{
+				if (bSuccess)
+				{
+					NotificationItem->SetText(FText::Format(INVTEXT("Exported {0} objects in {1} s"), FText::AsNumber(WrittenNum), FText::AsNumber(ElapsedSeconds)));
+					NotificationItem->SetHyperlink(
+						FSimpleDelegate::CreateLambda([Filename]() { FPlatformProcess::ExploreFolder(*Filename); }),
+						FText::FromString(FPaths::GetCleanFilename(Filename)));
+				}
+				else
+				{
+					NotificationItem->SetText(FText::Format(INVTEXT("Failed to open {0} for writing"), FText::FromString(Filename)));
+				}
+				NotificationItem->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+				NotificationItem->ExpireAndFadeout();
+			}
+		});
+	});
+}
+
+void FObjectOutlinerExporter::AppendCsvHeader(FStringBuilderBase& Builder)
+{
+	Builder.Append(TEXT("Path,Name,Class,Outer,Flags,ExclusiveBytes\n"));
+}
+
+void FObjectOutlinerExporter::AppendCsvRow(FStringBuilderBase& Builder, const UObject& Object, const uint64 ExclusiveBytes)
+{
+	TStringBuilder<512> Scratch;
+
+	Object.GetPathName(nullptr, Scratch);
+	FObjectOutlinerTextFileWriter::AppendCsvField(Builder, Scratch);
+	Builder.AppendChar(TEXT(','));
+
+	Scratch.Reset();
+	Object.GetFName().AppendString(Scratch);
+	FObjectOutlinerTextFileWriter::AppendCsvField(Builder, Scratch);
+	Builder.AppendChar(TEXT(','));
+
+	Scratch.Reset();
+	Object.GetClass()->GetFName().AppendString(Scratch);
+	FObjectOutlinerTextFileWriter::AppendCsvField(Builder, Scratch);
+	Builder.AppendChar(TEXT(','));
+
+	if (const UObject* Outer = Object.GetOuter())
+	{
+		Scratch.Reset();
+		Outer->GetPathName(nullptr, Scratch);
+		FObjectOutlinerTextFileWriter::AppendCsvField(Builder, Scratch);
+	}
+	Builder.AppendChar(TEXT(','));
+
+	Builder.Appendf(TEXT("0x%08X,"), static_cast<uint32>(Object.GetFlags()));
+	Builder.Appendf(TEXT("%llu\n"), ExclusiveBytes);
+}
+
+void FObjectOutlinerExporter::AppendJsonRow(FStringBuilderBase& Builder, const UObject& Object, const uint64 ExclusiveBytes)
+{
+	TStringBuilder<512> Scratch;
+
+	Builder.Append(TEXT("{\"path\":"));
+	Object.GetPathName(nullptr, Scratch);
+	FObjectOutlinerTextFileWriter::AppendJsonString(Builder, Scratch);
+
+	Builder.Append(TEXT(",\"name\":"));
+	Scratch.Reset();
+	Object.GetFName().AppendString(Scratch);
+	FObjectOutlinerTextFileWriter::AppendJsonString(Builder, Scratch);
+
+	Builder.Append(TEXT(",\"class\":"));
+	Scratch.Reset();
+	Object.GetClass()->GetFName().AppendString(Scratch);
+	FObjectOutlinerTextFileWriter::AppendJsonString(Builder, Scratch);
+
+	Builder.Append(TEXT(",\"outer\":"));
+	if (const UObject* Outer = Object.GetOuter())
+	{
+		Scratch.Reset();
+		Outer->GetPathName(nullptr, Scratch);
+		FObjectOutlinerTextFileWriter::AppendJsonString(Builder, Scratch);
+	}
+	else
+	{
+		Builder.Append(TEXT("null"));
+	}
+
+	Builder.Appendf(TEXT(",\"flags\":%u"), static_cast<uint32>(Object.GetFlags()));
+	Builder.Appendf(TEXT(",\"exclusiveBytes\":%llu}"), ExclusiveBytes);
+}
+}
@@ -0,0 +1,63 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace HazardTools
+{
+enum class EObjectOutlinerExportFormat : uint8
+{
+	Csv,
+	Json
+};
+
+/**
+ * Small text file writer that accumulates output in a string builder and flushes it to a buffered file archive
+ * once the builder grows past FlushThreshold, so the memory used while writing does not depend on the amount of rows
+ */
+class FObjectOutlinerTextFileWriter
+{
+public:
+	explicit FObjectOutlinerTextFileWriter(const FString& InFilename);
+	~FObjectOutlinerTextFileWriter();
+
+	[[nodiscard]] bool IsOpen() const { return FileWriter.IsValid(); }
+
+	// Append a chunk (typically one row) and call MaybeFlush() after it
+	FStringBuilderBase& GetBuilder() { return Buffer; }
+
+	void MaybeFlush();
+	void Close();
+
+	static void AppendCsvField(FStringBuilderBase& Builder, FStringView Value);
+	static void AppendJsonString(FStringBuilderBase& Builder, FStringView Value);
+
+private:
+	void Flush();
+
+	static constexpr int32 FlushThreshold = 64 * 1024;
+
+	TUniquePtr<FArchive> FileWriter;
+	TStringBuilder<1024> Buffer;
+};
+
+class FObjectOutlinerExporter
+{
+public:
+	// Ask user for destination file, format is deduced from chosen extension
+	static bool PickExportFilename(const TSharedPtr<const SWidget>& ParentWidget, FString& OutFilename, EObjectOutlinerExportFormat& OutFormat);
+
+	/**
+	 * Write Objects to Filename on a worker thread.
+	 * Resource sizes are captured on the game thread when called, since GetResourceSizeBytes is not thread safe.
+	 * Objects are resolved and formatted in chunks under FGCScopeGuard, objects collected in between are skipped.
+	 */
+	static void ExportAsync(TArray<TWeakObjectPtr<UObject>>&& Objects, const FString& Filename, EObjectOutlinerExportFormat Format);
+
+private:
+	static void AppendCsvHeader(FStringBuilderBase& Builder);
+	static void AppendCsvRow(FStringBuilderBase& Builder, const UObject& Object, uint64 ExclusiveBytes);
+	static void AppendJsonRow(FStringBuilderBase& Builder, const UObject& Object, uint64 ExclusiveBytes);
+};
+}
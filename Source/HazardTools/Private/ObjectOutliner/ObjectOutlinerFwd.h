@@ -9,11 +9,17 @@ class UHazardToolsObjectOutlinerSettings;
 namespace HazardTools
 {
 class FObjectOutlinerModel;
+class FObjectOutlinerPropertyQuery;
+class FObjectOutlinerReport;
 enum class EDisplayMode : uint8;
 
+struct FObjectOutlinerAnalysis;
 struct FObjectOutlinerFilter;
 struct FObjectOutlinerItem;
+struct FObjectOutlinerTextureInfo;
 class IDetailsView;
+class SObjectOutlinerInspector;
+class SObjectOutlinerTreemap;
 
 typedef TSharedPtr<FObjectOutlinerItem> FObjectOutlinerItemPtr;
 typedef TSharedRef<FObjectOutlinerItem> FObjectOutlinerItemRef;
@@ -0,0 +1,213 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerLeakDetector.h"
+
+#include "Editor.h"
+#include "HazardTools.h"
+#include "HazardToolsObjectOutlinerSettings.h"
+#include "ObjectOutlinerPopulationTracker.h"
+#include "ObjectOutlinerReport.h"
+#include "SObjectOutlinerReport.h"
+#include "Engine/GameInstance.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "UObject/ReferenceChainSearch.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+namespace HazardTools
+{
+TUniquePtr<FObjectOutlinerLeakDetector> FObjectOutlinerLeakDetector::Instance;
+
+void FObjectOutlinerLeakDetector::Startup()
+{
+	check(IsInGameThread());
+	if (Instance.IsValid() == false && FObjectOutlinerPopulationTracker::Get() != nullptr)
+	{
+		Instance = TUniquePtr<FObjectOutlinerLeakDetector>(new FObjectOutlinerLeakDetector());
+	}
+}
+
+void FObjectOutlinerLeakDetector::Shutdown()
+{
+	Instance.Reset();
+}
+
+FObjectOutlinerLeakDetector::FObjectOutlinerLeakDetector()
+{
+	FEditorDelegates::BeginPIE.AddRaw(this, &FObjectOutlinerLeakDetector::HandleBeginPIE);
+	// Sent at the very end of EndPlayMap, after PIE worlds were cleaned up and garbage collected
+	FEditorDelegates::ShutdownPIE.AddRaw(this, &FObjectOutlinerLeakDetector::HandleShutdownPIE);
+}
+
+FObjectOutlinerLeakDetector::~FObjectOutlinerLeakDetector()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(AnalyzeTickerHandle);
+	FEditorDelegates::BeginPIE.RemoveAll(this);
+	FEditorDelegates::ShutdownPIE.RemoveAll(this);
+
+	if (FObjectOutlinerPopulationTracker* Tracker = FObjectOutlinerPopulationTracker::Get())
+	{
+		Tracker->ResetFingerprint();
+	}
+}
+
+void FObjectOutlinerLeakDetector::HandleBeginPIE(bool /*bIsSimulating*/)
+{
+	if (FObjectOutlinerPopulationTracker* Tracker = FObjectOutlinerPopulationTracker::Get())
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Tracker->CaptureFingerprint();
+		UE_LOG(LogHazardTools, Verbose, TEXT("PIE leak detector: fingerprint captured in %.2f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+}
+
+void FObjectOutlinerLeakDetector::HandleShutdownPIE(bool /*bIsSimulating*/)
+{
+	// Let EndPlayMap unwind first, analysis runs its own full GC
+	if (AnalyzeTickerHandle.IsValid() == false)
+	{
+		AnalyzeTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FObjectOutlinerLeakDetector::HandleAnalyzeTick));
+	}
+}
+
+bool FObjectOutlinerLeakDetector::HandleAnalyzeTick(float /*DeltaTime*/)
+{
+	AnalyzeTickerHandle.Reset();
+	Analyze();
+	return false;
+}
+
+bool FObjectOutlinerLeakDetector::IsPIEObject(const UObject* Object)
+{
+	for (const UObject* It = Object; It != nullptr; It = It->GetOuter())
+	{
+		if (const UPackage* Package = Cast<UPackage>(It))
+		{
+			return Package->HasAnyPackageFlags(PKG_PlayInEditor);
+		}
+		if (It->IsA<UGameInstance>())
+		{
+			return true;
+		}
+		if (const UWorld* World = Cast<UWorld>(It))
+		{
+			if (World->WorldType == EWorldType::PIE)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+FString FObjectOutlinerLeakDetector::FindRetentionPath(UObject* Object)
+{
+	const FReferenceChainSearch Search(Object, EReferenceChainSearchMode::Shortest);
+	return Search.GetRootPath();
+}
+
+void FObjectOutlinerLeakDetector::Analyze()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerLeakDetector::Analyze);
+
+	FObjectOutlinerPopulationTracker* Tracker = FObjectOutlinerPopulationTracker::Get();
+	if (Tracker == nullptr || Tracker->HasFingerprint() == false || (GEditor != nullptr && GEditor->PlayWorld != nullptr))
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	SessionIndex++;
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+	TArray<UObject*> NewObjects;
+	Tracker->GetObjectsCreatedSinceFingerprint(NewObjects);
+	Tracker->ResetFingerprint();
+
+	// Group surviving PIE objects by class
+	TMap<UClass*, TArray<UObject*>> LeakedByClass;
+	int32 LeakedNum = 0;
+	for (UObject* Object : NewObjects)
+	{
+		if (IsPIEObject(Object))
+		{
+			LeakedByClass.FindOrAdd(Object->GetClass()).Add(Object);
+			LeakedNum++;
+		}
+	}
+
+	LeakedByClass.ValueSort([](const TArray<UObject*>& A, const TArray<UObject*>& B) { return A.Num() > B.Num(); });
+
+	const TSharedRef<FObjectOutlinerReport> Report = MakeShared<FObjectOutlinerReport>(FText::Format(INVTEXT("PIE Leaks (session {0})"), FText::AsNumber(SessionIndex)));
+	const int32 Column_Name = Report->AddColumn("Name", INVTEXT("Class / Object"), EObjectOutlinerReportColumnType::Text, 0.5f);
+	const int32 Column_Count = Report->AddColumn("Count", INVTEXT("Count"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_Memory = Report->AddColumn("Memory", INVTEXT("Memory"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Path = Report->AddColumn("Path", INVTEXT("Path"), EObjectOutlinerReportColumnType::Text, 0.3f);
+
+	// Reference chain search walks the whole object graph, do it only for representatives of the biggest groups.
+	// Leaked worlds keep most of other objects alive, so they always get one.
+	const int32 RetentionPathsNum = UHazardToolsObjectOutlinerSettings::Get().LeakRetentionPathsNum;
+	int32 ClassIndex = 0;
+	for (TPair<UClass*, TArray<UObject*>>& Pair : LeakedByClass)
+	{
+		FObjectOutlinerReportRow& ClassRow = Report->AddRow();
+		ClassRow.SetText(Column_Name, Pair.Key->GetName());
+		ClassRow.SetValue(Column_Count, Pair.Value.Num());
+		ClassRow.Object = Pair.Key;
+
+		const bool bFindRetentionPath = ClassIndex < RetentionPathsNum || Pair.Key->IsChildOf<UWorld>();
+		int64 ClassMemory = 0;
+		for (int32 ObjectIndex = 0; ObjectIndex < Pair.Value.Num(); ++ObjectIndex)
+		{
+			UObject* Object = Pair.Value[ObjectIndex];
+			const int64 ObjectMemory = Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+			ClassMemory += ObjectMemory;
+
+			FObjectOutlinerReportRow& ObjectRow = ClassRow.AddChild(Report->Columns.Num());
+			ObjectRow.SetText(Column_Name, Object->GetName());
+			ObjectRow.SetValue(Column_Count, 1);
+			ObjectRow.SetValue(Column_Memory, ObjectMemory);
+			ObjectRow.SetText(Column_Path, Object->GetPathName());
+			ObjectRow.Object = Object;
+
+			if (bFindRetentionPath && ObjectIndex == 0)
+			{
+				ObjectRow.bHighlight = true;
+				ObjectRow.bKeepChildrenOrder = true;
+				ObjectRow.Tooltip = FindRetentionPath(Object);
+
+				TArray<FString> Lines;
+				ObjectRow.Tooltip.ParseIntoArrayLines(Lines);
+				for (FString& Line : Lines)
+				{
+					ObjectRow.AddChild(Report->Columns.Num()).SetText(Column_Name, Line.TrimStartAndEnd());
+				}
+			}
+		}
+		ClassRow.SetValue(Column_Memory, ClassMemory);
+		ClassIndex++;
+	}
+
+	Report->Summary = FText::Format(
+		INVTEXT("{0} PIE objects of {1} classes survived the session ({2} other objects created during PIE are still alive). Highlighted rows contain retention path."),
+		FText::AsNumber(LeakedNum),
+		FText::AsNumber(LeakedByClass.Num()),
+		FText::AsNumber(NewObjects.Num() - LeakedNum));
+
+	LastReport = Report;
+
+	UE_LOG(LogHazardTools, Log, TEXT("PIE leak detector: %d leaked objects of %d classes, analyzed in %.2f s"), LeakedNum, LeakedByClass.Num(), FPlatformTime::Seconds() - StartTime);
+
+	if (LeakedNum > 0)
+	{
+		FNotificationInfo Info(FText::Format(INVTEXT("{0} objects leaked from PIE session"), FText::AsNumber(LeakedNum)));
+		Info.ExpireDuration = 8.0f;
+		Info.Hyperlink = FSimpleDelegate::CreateLambda([Report]() { SObjectOutlinerReport::OpenWindow(Report); });
+		Info.HyperlinkText = INVTEXT("Show Report");
+		if (const TSharedPtr<SNotificationItem> InfoItem = FSlateNotificationManager::Get().AddNotification(Info))
+		{
+			InfoItem->SetCompletionState(SNotificationItem::CS_Fail);
+		}
+	}
+}
+}
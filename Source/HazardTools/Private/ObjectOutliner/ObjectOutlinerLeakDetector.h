@@ -0,0 +1,48 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+namespace HazardTools
+{
+class FObjectOutlinerReport;
+
+/**
+ * Before/after comparison of object population around Play In Editor sessions.
+ * On PIE begin population tracker captures a fingerprint (one bit per object slot, cleared on delete).
+ * After PIE shutdown and a full GC, objects not present in fingerprint that belong to PIE (PIE package, PIE world or game instance)
+ * are reported grouped by class, with reference chains for the biggest groups.
+ */
+class FObjectOutlinerLeakDetector
+{
+public:
+	static void Startup();
+	static void Shutdown();
+
+	static FObjectOutlinerLeakDetector* Get() { return Instance.Get(); }
+
+	~FObjectOutlinerLeakDetector();
+
+	// Null until first PIE session ends
+	const TSharedPtr<FObjectOutlinerReport>& GetLastReport() const { return LastReport; }
+
+private:
+	FObjectOutlinerLeakDetector();
+
+	void HandleBeginPIE(bool bIsSimulating);
+	void HandleShutdownPIE(bool bIsSimulating);
+	bool HandleAnalyzeTick(float DeltaTime);
+
+	void Analyze();
+	static bool IsPIEObject(const UObject* Object);
+	static FString FindRetentionPath(UObject* Object);
+
+	static TUniquePtr<FObjectOutlinerLeakDetector> Instance;
+
+	TSharedPtr<FObjectOutlinerReport> LastReport;
+	FTSTicker::FDelegateHandle AnalyzeTickerHandle;
+	int32 SessionIndex = 0;
+};
+}
@@ -2,6 +2,10 @@
 
 #include "ObjectOutlinerModel.h"
 #include "ObjectOutlinerTypes.h"
+#include "ObjectOutlinerPopulationTracker.h"
+#include "ObjectOutlinerPropertyQuery.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
 
 namespace HazardTools
 {
@@ -9,8 +13,10 @@ FObjectOutlinerModel::FObjectOutlinerModel()
 {
 }
 
-void FObjectOutlinerModel::UpdateContent(const bool bHierarchical, TMap<UObject*, FObjectOutlinerItemPtr>* OutProcessedObjectsMapPtr /*= nullptr*/)
+void FObjectOutlinerModel::UpdateContent(const EDisplayMode DisplayMode, TMap<UObject*, FObjectOutlinerItemPtr>* OutProcessedObjectsMapPtr /*= nullptr*/)
 {
+	const bool bHierarchical = DisplayMode != EDisplayMode::List;
+
 	RootContent.Reset();
 	DiscoveredNum = 0;
 	FilteredNum = 0;
@@ -24,41 +30,128 @@ void FObjectOutlinerModel::UpdateContent(const bool bHierarchical, TMap<UObject*
 	{
 		TSet<UObject*> FilteredObjectsSet;
 
-		for (FThreadSafeObjectIterator It; It; ++It)
+		typedef TPair<int64, UObject*> FSizedObject;
+		const auto TopHeapPredicate = [](const FSizedObject& A, const FSizedObject& B) { return A.Key < B.Key; };
+		TArray<FSizedObject> TopHeap;
+		TopHeap.Reserve(TopNBySize + 1);
+
+		const auto AcceptObject = [&](UObject* Object, const int64 KnownMemory)
+		{
+			if (bHierarchical)
+			{
+				FilteredObjectsSet.Add(Object); // Process it later	
+			}
+			else
+			{
+				RootContent.Add(MakeShared<FObjectOutlinerItem>(Object));
+				RootContent.Last()->CachedMemory = KnownMemory;
+				if (OutProcessedObjectsMapPtr != nullptr)
+				{
+					OutProcessedObjectsMapPtr->Add(Object, RootContent.Last());
+				}
+			}
+		};
+
+		const auto ProcessObject = [&](UObject* Object)
 		{
 			DiscoveredNum++;
 
-			if (ShouldItemPassFilterDelegate.IsBound() && ShouldItemPassFilterDelegate.Execute(*It) == false)
+			if (ShouldItemPassFilterDelegate.IsBound() && ShouldItemPassFilterDelegate.Execute(Object) == false)
 			{
-				continue;;
+				return;
 			}
 
 			FilteredNum++;
 
-			if (ShouldItemPassTextFilterDelegate.IsBound() && ShouldItemPassTextFilterDelegate.Execute(*It) == false)
+			if (ShouldItemPassTextFilterDelegate.IsBound() && ShouldItemPassTextFilterDelegate.Execute(Object) == false)
 			{
-				continue;;
+				return;
 			}
 
-			if (bHierarchical)
+			if (TopNBySize > 0)
 			{
-				FilteredObjectsSet.Add(*It); // Process it later	
+				// Each size is computed once, heap top is the smallest of current N biggest
+				const int64 Size = Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+				if (TopHeap.Num() < TopNBySize)
+				{
+					TopHeap.HeapPush(FSizedObject(Size, Object), TopHeapPredicate);
+				}
+				else if (Size > TopHeap.HeapTop().Key)
+				{
+					TopHeap.HeapPopDiscard(TopHeapPredicate, EAllowShrinking::No);
+					TopHeap.HeapPush(FSizedObject(Size, Object), TopHeapPredicate);
+				}
+				return;
 			}
-			else
+
+			AcceptObject(Object, INDEX_NONE);
+		};
+
+		if (PropertyQuery.IsValid())
+		{
+			TArray<UObject*> Matches;
+			PropertyQuery->Execute(Matches);
+
+			TSet<const UObjectBase*> ScopeWorlds;
+			if (WorldScope.IsValid())
 			{
-				RootContent.Add(MakeShared<FObjectOutlinerItem>(*It));
-				if (OutProcessedObjectsMapPtr != nullptr)
+				GetWorldScopeSet(WorldScope.Get(), ScopeWorlds);
+			}
+
+			for (UObject* Object : Matches)
+			{
+				if (ScopeWorlds.Num() == 0 || ScopeWorlds.Contains(FObjectOutlinerPopulationTracker::FindOuterWorld(Object)))
 				{
-					OutProcessedObjectsMapPtr->Add(*It, RootContent.Last());
+					ProcessObject(Object);
 				}
 			}
 		}
+		else if (WorldScope.IsValid())
+		{
+			TArray<UObject*> WorldObjects;
+			GatherWorldObjects(WorldScope.Get(), WorldObjects);
+			for (UObject* Object : WorldObjects)
+			{
+				ProcessObject(Object);
+			}
+		}
+		else
+		{
+			WorldScope.Reset(); // Scoped world may be destroyed (PIE ended)
+			for (FThreadSafeObjectIterator It; It; ++It)
+			{
+				ProcessObject(*It);
+			}
+		}
+
+		if (TopNBySize > 0)
+		{
+			// Biggest first, only N items are sorted
+			TopHeap.Sort([](const FSizedObject& A, const FSizedObject& B) { return A.Key > B.Key; });
+			for (const FSizedObject& SizedObject : TopHeap)
+			{
+				AcceptObject(SizedObject.Value, SizedObject.Key);
+			}
+		}
 
 		if (bHierarchical)
 		{
 			TMap<UObject*, FObjectOutlinerItemPtr> LocalProcessedObjectsMap;
 			TMap<UObject*, FObjectOutlinerItemPtr>& ProcessedObjectsMapRef = OutProcessedObjectsMapPtr ? *OutProcessedObjectsMapPtr : LocalProcessedObjectsMap;
 
+			if (DisplayMode == EDisplayMode::ClassTree)
+			{
+				BuildClassTree(FilteredObjectsSet, ProcessedObjectsMapRef);
+				DisplayedNum = FilteredObjectsSet.Num();
+				return;
+			}
+			if (DisplayMode == EDisplayMode::Packages)
+			{
+				BuildPackageTree(FilteredObjectsSet, ProcessedObjectsMapRef);
+				DisplayedNum = FilteredObjectsSet.Num();
+				return;
+			}
+
 			for (auto It = FilteredObjectsSet.CreateIterator(); It; ++It)
 			{
 				AddItemToTreeView(*It, ProcessedObjectsMapRef, true);
@@ -69,6 +162,180 @@ void FObjectOutlinerModel::UpdateContent(const bool bHierarchical, TMap<UObject*
 	}
 }
 
+void FObjectOutlinerModel::GetScopeWorlds(TArray<UWorld*>& OutWorlds)
+{
+	OutWorlds.Reset();
+	for (TObjectIterator<UWorld> It; It; ++It)
+	{
+		// Streaming sublevels have own UWorld objects, they are part of owning world scope
+		const ULevel* PersistentLevel = It->PersistentLevel;
+		if (IsValid(*It) && (PersistentLevel == nullptr || PersistentLevel->OwningWorld == nullptr || PersistentLevel->OwningWorld == *It))
+		{
+			OutWorlds.Add(*It);
+		}
+	}
+}
+
+void FObjectOutlinerModel::GetWorldScopeSet(UWorld* World, TSet<const UObjectBase*>& OutWorlds)
+{
+	OutWorlds.Add(World);
+	for (TObjectIterator<UWorld> It; It; ++It)
+	{
+		if (It->PersistentLevel != nullptr && It->PersistentLevel->OwningWorld == World)
+		{
+			OutWorlds.Add(*It);
+		}
+	}
+}
+
+void FObjectOutlinerModel::GatherWorldObjects(UWorld* World, TArray<UObject*>& OutObjects)
+{
+	check(World != nullptr);
+
+	TSet<const UObjectBase*> Worlds;
+	GetWorldScopeSet(World, Worlds);
+
+	if (const FObjectOutlinerPopulationTracker* Tracker = FObjectOutlinerPopulationTracker::Get())
+	{
+		TArray<int32> Indices;
+		for (const UObjectBase* ScopeWorld : Worlds)
+		{
+			Tracker->GetWorldObjectIndices(static_cast<const UWorld*>(ScopeWorld), Indices);
+		}
+
+		OutObjects.Reserve(Indices.Num());
+		for (const int32 Index : Indices)
+		{
+			const FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(Index);
+			if (ObjectItem == nullptr || ObjectItem->IsUnreachable() || ObjectItem->GetObject() == nullptr)
+			{
+				continue;
+			}
+
+			// Index was resolved at creation time, object could be renamed to another outer since then
+			UObject* Object = static_cast<UObject*>(ObjectItem->GetObject());
+			if (Worlds.Contains(FObjectOutlinerPopulationTracker::FindOuterWorld(Object)))
+			{
+				OutObjects.Add(Object);
+			}
+		}
+		return;
+	}
+
+	// No index, fallback to full scan
+	for (FThreadSafeObjectIterator It; It; ++It)
+	{
+		if (Worlds.Contains(FObjectOutlinerPopulationTracker::FindOuterWorld(*It)))
+		{
+			OutObjects.Add(*It);
+		}
+	}
+}
+
+void FObjectOutlinerModel::BuildClassTree(const TSet<UObject*>& Objects, TMap<UObject*, FObjectOutlinerItemPtr>& ProcessedObjectsMap)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerModel::BuildClassTree);
+
+	// Bucket instances per exact class, one pass over objects, memory is summed when instance items are created
+	struct FClassBucket
+	{
+		TArray<UObject*> Instances;
+		int64 Memory = 0;
+	};
+	TMap<UClass*, FClassBucket> Buckets;
+	for (UObject* Object : Objects)
+	{
+		Buckets.FindOrAdd(Object->GetClass()).Instances.Add(Object);
+	}
+
+	// Class nodes for every class with instances and all of its super classes
+	TMap<UClass*, FObjectOutlinerItemPtr> ClassNodes;
+	const auto FindOrAddClassNode = [&](UClass* Class)
+	{
+		if (const FObjectOutlinerItemPtr* Existing = ClassNodes.Find(Class))
+		{
+			return *Existing;
+		}
+
+		FObjectOutlinerItemPtr Node = MakeShared<FObjectOutlinerItem>(Class);
+		Node->bIsGroupNode = true;
+		ClassNodes.Add(Class, Node);
+		return Node;
+	};
+
+	for (TPair<UClass*, FClassBucket>& Pair : Buckets)
+	{
+		FObjectOutlinerItemPtr ClassNode = FindOrAddClassNode(Pair.Key);
+		for (UObject* Instance : Pair.Value.Instances)
+		{
+			const TSharedRef<FObjectOutlinerItem> InstanceItem = MakeShared<FObjectOutlinerItem>(Instance);
+			Pair.Value.Memory += InstanceItem->GetMemory();
+			ClassNode->AddChild(InstanceItem);
+			ProcessedObjectsMap.Add(Instance, InstanceItem);
+		}
+
+		// Aggregate up the class tree, linking missing parents on the way
+		for (UClass* Class = Pair.Key; Class != nullptr; Class = Class->GetSuperClass())
+		{
+			const FObjectOutlinerItemPtr Node = FindOrAddClassNode(Class);
+			Node->GroupedNum += Pair.Value.Instances.Num();
+			Node->GroupedMemory += Pair.Value.Memory;
+
+			UClass* SuperClass = Class->GetSuperClass();
+			if (SuperClass != nullptr && Node->GetParent() == nullptr)
+			{
+				FindOrAddClassNode(SuperClass)->AddChild(Node.ToSharedRef());
+			}
+		}
+	}
+
+	for (const TPair<UClass*, FObjectOutlinerItemPtr>& Pair : ClassNodes)
+	{
+		// Class nodes win over class objects listed as instances, they are the ones being expanded
+		ProcessedObjectsMap.Add(Pair.Key, Pair.Value);
+		if (Pair.Value->GetParent() == nullptr)
+		{
+			RootContent.Add(Pair.Value);
+		}
+	}
+}
+
+void FObjectOutlinerModel::BuildPackageTree(const TSet<UObject*>& Objects, TMap<UObject*, FObjectOutlinerItemPtr>& ProcessedObjectsMap)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerModel::BuildPackageTree);
+
+	// Objects come from the single filtered pass over object array, here they are only bucketed by outermost package
+	TMap<UPackage*, FObjectOutlinerItemPtr> PackageNodes;
+	for (UObject* Object : Objects)
+	{
+		UPackage* Package = Object->GetOutermost();
+		FObjectOutlinerItemPtr& PackageNode = PackageNodes.FindOrAdd(Package);
+		if (PackageNode.IsValid() == false)
+		{
+			PackageNode = MakeShared<FObjectOutlinerItem>(Package);
+			PackageNode->bIsGroupNode = true;
+		}
+
+		const TSharedRef<FObjectOutlinerItem> ObjectItem = MakeShared<FObjectOutlinerItem>(Object);
+		PackageNode->GroupedNum++;
+		PackageNode->GroupedMemory += ObjectItem->GetMemory();
+
+		// Package object itself is represented by its node
+		if (Object != Package)
+		{
+			PackageNode->AddChild(ObjectItem);
+			ProcessedObjectsMap.Add(Object, ObjectItem);
+		}
+	}
+
+	RootContent.Reserve(PackageNodes.Num());
+	for (const TPair<UPackage*, FObjectOutlinerItemPtr>& Pair : PackageNodes)
+	{
+		ProcessedObjectsMap.Add(Pair.Key, Pair.Value);
+		RootContent.Add(Pair.Value);
+	}
+}
+
 FObjectOutlinerItemPtr FObjectOutlinerModel::AddItemToTreeView(UObject* NewItemObjectPtr, TMap<UObject*, FObjectOutlinerItemPtr>& ProcessedObjectsMap, const bool bExplicitlyAdded)
 {
 	check(NewItemObjectPtr != nullptr)
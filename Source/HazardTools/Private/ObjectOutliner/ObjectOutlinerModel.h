@@ -38,16 +38,42 @@ public:
 	[[nodiscard]] int32 GetFilteredNum() const { return FilteredNum; }
 	[[nodiscard]] int32 GetDisplayedNum() const { return DisplayedNum; }
 
-	void UpdateContent(const bool bHierarchical, TMap<UObject*, FObjectOutlinerItemPtr>* OutProcessedObjectsMapPtr = nullptr);
+	void UpdateContent(EDisplayMode DisplayMode, TMap<UObject*, FObjectOutlinerItemPtr>* OutProcessedObjectsMapPtr = nullptr);
+
+	// Null world means all objects. When world is destroyed scope is reset back to all objects on next update.
+	void SetWorldScope(UWorld* InWorld) { WorldScope = InWorld; }
+	UWorld* GetWorldScope() const { return WorldScope.Get(); }
+
+	// Root worlds (not streaming sublevel worlds) that can be used as a scope
+	static void GetScopeWorlds(TArray<UWorld*>& OutWorlds);
+
+	// Objects inside World and its streaming sublevels, uses population tracker index if available
+	static void GatherWorldObjects(UWorld* World, TArray<UObject*>& OutObjects);
+	// World itself and its streaming sublevel worlds
+	static void GetWorldScopeSet(UWorld* World, TSet<const UObjectBase*>& OutWorlds);
+
+	// When set, only objects matching the query are considered (instead of scanning all objects)
+	void SetPropertyQuery(const TSharedPtr<const FObjectOutlinerPropertyQuery>& InPropertyQuery) { PropertyQuery = InPropertyQuery; }
+	const TSharedPtr<const FObjectOutlinerPropertyQuery>& GetPropertyQuery() const { return PropertyQuery; }
+
+	// When positive only N objects with biggest exclusive resource size pass, selected with a bounded heap during the scan
+	void SetTopNBySize(const int32 InTopNBySize) { TopNBySize = FMath::Max(0, InTopNBySize); }
+	[[nodiscard]] int32 GetTopNBySize() const { return TopNBySize; }
 
 private:
 	FObjectOutlinerItemPtr AddItemToTreeView(UObject* NewItemObjectPtr, TMap<UObject*, FObjectOutlinerItemPtr>& ProcessedObjectsMap, const bool bExplicitlyAdded);
+	void BuildClassTree(const TSet<UObject*>& Objects, TMap<UObject*, FObjectOutlinerItemPtr>& ProcessedObjectsMap);
+	void BuildPackageTree(const TSet<UObject*>& Objects, TMap<UObject*, FObjectOutlinerItemPtr>& ProcessedObjectsMap);
 
 	TArray<FObjectOutlinerItemPtr> RootContent;
 
 	FShouldPassItem ShouldItemPassFilterDelegate;
 	FShouldPassItem ShouldItemPassTextFilterDelegate;
 
+	TWeakObjectPtr<UWorld> WorldScope;
+	TSharedPtr<const FObjectOutlinerPropertyQuery> PropertyQuery;
+	int32 TopNBySize = 0;
+
 	int32 DiscoveredNum = 0;
 	int32 FilteredNum = 0;
 	int32 DisplayedNum = 0;
@@ -0,0 +1,372 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerPackageInspector.h"
+
+#include "DesktopPlatformModule.h"
+#include "IDesktopPlatform.h"
+#include "ObjectOutlinerReport.h"
+#include "SObjectOutlinerReport.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Serialization/MemoryReader.h"
+#include "UObject/ObjectResource.h"
+#include "UObject/PackageFileSummary.h"
+#include "UObject/UnrealNames.h"
+
+namespace HazardTools
+{
+namespace PackageInspector
+{
+	// Resolves serialized name indices against package name map, the way FLinkerLoad does
+	class FTableReader final : public FMemoryReaderView
+	{
+	public:
+		explicit FTableReader(const TConstArrayView<uint8> Data)
+			: FMemoryReaderView(MakeMemoryView(Data.GetData(), Data.Num()), true)
+		{
+		}
+
+		virtual FArchive& operator<<(FName& Name) override
+		{
+			int32 NameIndex = 0;
+			int32 Number = 0;
+			*this << NameIndex << Number;
+
+			if (NameMap.IsValidIndex(NameIndex))
+			{
+				Name = FName(NameMap[NameIndex], Number);
+			}
+			else
+			{
+				Name = NAME_None;
+				SetError();
+			}
+			return *this;
+		}
+
+		virtual FString GetArchiveName() const override { return TEXT("FObjectOutlinerPackageInspector"); }
+
+		TArray<FName> NameMap;
+	};
+
+	// Mirrors FObjectDataResource serialization, bulk data payloads with their owning export
+	struct FDataResource
+	{
+		int64 SerialSize = 0;
+		FPackageIndex OuterIndex;
+	};
+
+	bool ReadDataResources(FArchive& Ar, TArray<FDataResource>& OutResources)
+	{
+		enum EVersion : uint32 { Invalid, Initial, AddedCookedIndex, Latest = AddedCookedIndex };
+
+		uint32 Version = Invalid;
+		Ar << Version;
+		if (Version == Invalid || Version > Latest)
+		{
+			return false;
+		}
+
+		int32 Num = 0;
+		Ar << Num;
+		if (Num < 0 || Ar.IsError())
+		{
+			return false;
+		}
+
+		OutResources.Reserve(Num);
+		for (int32 Index = 0; Index < Num && Ar.IsError() == false; ++Index)
+		{
+			uint32 Flags = 0;
+			uint8 CookedIndex = 0;
+			int64 SerialOffset = 0;
+			int64 DuplicateSerialOffset = 0;
+			int64 RawSize = 0;
+			uint32 LegacyBulkDataFlags = 0;
+
+			FDataResource& Resource = OutResources.AddDefaulted_GetRef();
+			Ar << Flags;
+			if (Version >= AddedCookedIndex)
+			{
+				Ar << CookedIndex;
+			}
+			Ar << SerialOffset << DuplicateSerialOffset << Resource.SerialSize << RawSize << Resource.OuterIndex << LegacyBulkDataFlags;
+		}
+		return Ar.IsError() == false;
+	}
+}
+
+void FObjectOutlinerPackageInspector::ReadPackages(const TArray<FString>& Filenames, TArray<FObjectOutlinerPackageInfo>& OutPackages)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerPackageInspector::ReadPackages);
+
+	OutPackages.SetNum(Filenames.Num());
+	ParallelFor(Filenames.Num(), [&](const int32 Index)
+	{
+		OutPackages[Index] = ReadPackage(Filenames[Index]);
+	});
+}
+
+FObjectOutlinerPackageInfo FObjectOutlinerPackageInspector::ReadPackage(const FString& Filename)
+{
+	FObjectOutlinerPackageInfo Info;
+	Info.Filename = Filename;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	// Mapped region must be released before the handle
+	const TUniquePtr<IMappedFileHandle> MappedHandle(PlatformFile.OpenMapped(*Filename));
+	if (MappedHandle.IsValid())
+	{
+		Info.FileSize = MappedHandle->GetFileSize();
+		const TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle->MapRegion(0, Info.FileSize));
+		if (MappedRegion.IsValid())
+		{
+			ReadTables(TConstArrayView<uint8>(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize()), Info);
+			return Info;
+		}
+	}
+
+	// Platform without memory mapping support
+	TArray<uint8> FileData;
+	if (FFileHelper::LoadFileToArray(FileData, *Filename, FILEREAD_Silent) == false)
+	{
+		Info.Error = TEXT("Can't open file");
+		return Info;
+	}
+	Info.FileSize = FileData.Num();
+	ReadTables(FileData, Info);
+	return Info;
+}
+
+void FObjectOutlinerPackageInspector::ReadTables(const TConstArrayView<uint8> Data, FObjectOutlinerPackageInfo& OutInfo)
+{
+	PackageInspector::FTableReader Reader(Data);
+
+	FPackageFileSummary Summary;
+	Reader << Summary;
+	if (Reader.IsError() || Summary.Tag != PACKAGE_FILE_TAG)
+	{
+		OutInfo.Error = TEXT("Not a package file or cooked package");
+		return;
+	}
+	if (Summary.IsFileVersionTooOld() || Summary.IsFileVersionTooNew())
+	{
+		OutInfo.Error = TEXT("Unsupported package version");
+		return;
+	}
+
+	Reader.SetUEVer(Summary.GetFileVersionUE());
+	Reader.SetLicenseeUEVer(Summary.GetFileVersionLicenseeUE());
+	Reader.SetEngineVer(Summary.SavedByEngineVersion);
+	Reader.SetCustomVersions(Summary.GetCustomVersionContainer());
+	Reader.SetFilterEditorOnly((Summary.GetPackageFlags() & PKG_FilterEditorOnly) != 0);
+
+	OutInfo.TotalHeaderSize = Summary.TotalHeaderSize;
+	OutInfo.ImportNum = Summary.ImportCount;
+
+	// Every table entry takes more than a byte, anything bigger is a corrupted summary
+	const auto IsValidTable = [&](const int32 Count, const int64 Offset)
+	{
+		return Count >= 0 && Count <= Data.Num() && Offset >= 0 && Offset <= Data.Num();
+	};
+	if (IsValidTable(Summary.NameCount, Summary.NameOffset) == false
+	    || IsValidTable(Summary.ImportCount, Summary.ImportOffset) == false
+	    || IsValidTable(Summary.ExportCount, Summary.ExportOffset) == false)
+	{
+		OutInfo.Error = TEXT("Corrupted package summary");
+		return;
+	}
+
+	Reader.Seek(Summary.NameOffset);
+	Reader.NameMap.Reserve(Summary.NameCount);
+	for (int32 Index = 0; Index < Summary.NameCount && Reader.IsError() == false; ++Index)
+	{
+		FNameEntrySerialized NameEntry(ENAME_LinkerConstructor);
+		Reader << NameEntry;
+		Reader.NameMap.Add(FName(NameEntry));
+	}
+
+	TArray<FObjectImport> Imports;
+	Reader.Seek(Summary.ImportOffset);
+	Imports.SetNum(Summary.ImportCount);
+	for (int32 Index = 0; Index < Summary.ImportCount && Reader.IsError() == false; ++Index)
+	{
+		Reader << Imports[Index];
+	}
+
+	TArray<FObjectExport> Exports;
+	Reader.Seek(Summary.ExportOffset);
+	Exports.SetNum(Summary.ExportCount);
+	for (int32 Index = 0; Index < Summary.ExportCount && Reader.IsError() == false; ++Index)
+	{
+		Reader << Exports[Index];
+	}
+
+	if (Reader.IsError())
+	{
+		OutInfo.Error = TEXT("Failed to read package tables");
+		return;
+	}
+
+	OutInfo.Exports.SetNum(Exports.Num());
+	for (int32 Index = 0; Index < Exports.Num(); ++Index)
+	{
+		const FObjectExport& Export = Exports[Index];
+		FObjectOutlinerPackageExport& Result = OutInfo.Exports[Index];
+
+		Result.ObjectName = Export.ObjectName;
+		Result.SerialSize = Export.SerialSize;
+		Result.bIsAsset = Export.bIsAsset;
+		Result.OuterExportIndex = Export.OuterIndex.IsExport() ? Export.OuterIndex.ToExport() : INDEX_NONE;
+
+		if (Export.ClassIndex.IsImport() && Imports.IsValidIndex(Export.ClassIndex.ToImport()))
+		{
+			Result.ClassName = Imports[Export.ClassIndex.ToImport()].ObjectName;
+		}
+		else if (Export.ClassIndex.IsExport() && Exports.IsValidIndex(Export.ClassIndex.ToExport()))
+		{
+			Result.ClassName = Exports[Export.ClassIndex.ToExport()].ObjectName;
+		}
+		else
+		{
+			Result.ClassName = NAME_Class; // Null class index means export is a UClass
+		}
+	}
+
+	// Data resources (bulk data) are optional, missing table does not make package unreadable
+	if (Summary.DataResourceOffset > 0 && Summary.DataResourceOffset < Data.Num())
+	{
+		Reader.Seek(Summary.DataResourceOffset);
+
+		TArray<PackageInspector::FDataResource> DataResources;
+		if (PackageInspector::ReadDataResources(Reader, DataResources))
+		{
+			for (const PackageInspector::FDataResource& Resource : DataResources)
+			{
+				if (Resource.OuterIndex.IsExport() && OutInfo.Exports.IsValidIndex(Resource.OuterIndex.ToExport()))
+				{
+					OutInfo.Exports[Resource.OuterIndex.ToExport()].BulkDataSize += Resource.SerialSize;
+				}
+			}
+		}
+	}
+}
+
+TSharedRef<FObjectOutlinerReport> FObjectOutlinerPackageInspector::MakeReport(const TArray<FObjectOutlinerPackageInfo>& Packages)
+{
+	const TSharedRef<FObjectOutlinerReport> Report = MakeShared<FObjectOutlinerReport>(INVTEXT("Package Exports"));
+	const int32 Column_Name = Report->AddColumn("Name", INVTEXT("Name"), EObjectOutlinerReportColumnType::Text, 0.35f);
+	const int32 Column_Class = Report->AddColumn("Class", INVTEXT("Class"), EObjectOutlinerReportColumnType::Text, 0.2f);
+	const int32 Column_Serial = Report->AddColumn("SerialSize", INVTEXT("Serial Size"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Bulk = Report->AddColumn("BulkDataSize", INVTEXT("Bulk Data"), EObjectOutlinerReportColumnType::Memory, 0.1f);
+	const int32 Column_Exports = Report->AddColumn("Exports", INVTEXT("Exports"), EObjectOutlinerReportColumnType::Number, 0.08f);
+	const int32 Column_Info = Report->AddColumn("Info", INVTEXT("Info"), EObjectOutlinerReportColumnType::Text, 0.17f);
+
+	int32 TotalExportsNum = 0;
+	int32 FailedNum = 0;
+	for (const FObjectOutlinerPackageInfo& Package : Packages)
+	{
+		FObjectOutlinerReportRow& PackageRow = Report->AddRow();
+		PackageRow.SetText(Column_Name, FPaths::GetCleanFilename(Package.Filename));
+		PackageRow.SetText(Column_Class, TEXT("Package"));
+		PackageRow.SetValue(Column_Exports, Package.Exports.Num());
+		PackageRow.Tooltip = Package.Filename;
+
+		if (Package.Error.IsEmpty() == false)
+		{
+			PackageRow.SetText(Column_Info, Package.Error);
+			PackageRow.bHighlight = true;
+			FailedNum++;
+			continue;
+		}
+
+		PackageRow.SetText(Column_Info, FString::Printf(TEXT("%d imports, header %s, file %s"),
+			Package.ImportNum,
+			*FText::AsMemory(Package.TotalHeaderSize, IEC).ToString(),
+			*FText::AsMemory(Package.FileSize, IEC).ToString()));
+
+		// Rows are created first, then linked to outers since outer may come after inner in export table
+		TArray<TSharedPtr<FObjectOutlinerReportRow>> ExportRows;
+		ExportRows.Reserve(Package.Exports.Num());
+		int64 SerialSize = 0;
+		int64 BulkDataSize = 0;
+		for (const FObjectOutlinerPackageExport& Export : Package.Exports)
+		{
+			const TSharedRef<FObjectOutlinerReportRow> Row = MakeShared<FObjectOutlinerReportRow>();
+			Row->Cells.SetNum(Report->Columns.Num());
+			Row->SetText(Column_Name, Export.ObjectName.ToString());
+			Row->SetText(Column_Class, Export.ClassName.ToString());
+			Row->SetValue(Column_Serial, Export.SerialSize);
+			Row->SetValue(Column_Bulk, Export.BulkDataSize);
+			Row->bHighlight = Export.bIsAsset;
+			ExportRows.Add(Row);
+
+			SerialSize += Export.SerialSize;
+			BulkDataSize += Export.BulkDataSize;
+		}
+
+		for (int32 Index = 0; Index < Package.Exports.Num(); ++Index)
+		{
+			const int32 OuterIndex = Package.Exports[Index].OuterExportIndex;
+			if (ExportRows.IsValidIndex(OuterIndex) && OuterIndex != Index)
+			{
+				ExportRows[OuterIndex]->Children.Add(ExportRows[Index]);
+			}
+			else
+			{
+				PackageRow.Children.Add(ExportRows[Index]);
+			}
+		}
+
+		PackageRow.SetValue(Column_Serial, SerialSize);
+		PackageRow.SetValue(Column_Bulk, BulkDataSize);
+		TotalExportsNum += Package.Exports.Num();
+	}
+
+	Report->Summary = FText::Format(
+		INVTEXT("{0} packages, {1} exports, {2} failed to read. Assets are highlighted."),
+		FText::AsNumber(Packages.Num()),
+		FText::AsNumber(TotalExportsNum),
+		FText::AsNumber(FailedNum));
+
+	return Report;
+}
+
+void FObjectOutlinerPackageInspector::PickAndInspectPackages(const TSharedPtr<const SWidget>& ParentWidget)
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (DesktopPlatform == nullptr)
+	{
+		return;
+	}
+
+	TArray<FString> Filenames;
+	const bool bPicked = DesktopPlatform->OpenFileDialog(
+		FSlateApplication::Get().FindBestParentWindowHandleForDialogs(ParentWidget),
+		TEXT("Inspect Packages"),
+		FPaths::ProjectContentDir(),
+		TEXT(""),
+		TEXT("Unreal packages (*.uasset;*.umap)|*.uasset;*.umap"),
+		EFileDialogFlags::Multiple,
+		Filenames);
+
+	if (bPicked == false || Filenames.Num() == 0)
+	{
+		return;
+	}
+
+	const auto Generate = [Filenames]() -> TSharedPtr<FObjectOutlinerReport>
+	{
+		FScopedSlowTask SlowTask(0.f, INVTEXT("Reading package tables..."));
+		SlowTask.MakeDialogDelayed(0.5f);
+
+		TArray<FObjectOutlinerPackageInfo> Packages;
+		ReadPackages(Filenames, Packages);
+		return MakeReport(Packages);
+	};
+
+	SObjectOutlinerReport::OpenWindow(Generate().ToSharedRef(), FObjectOutlinerReportGenerator::CreateLambda(Generate));
+}
+}
@@ -0,0 +1,52 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace HazardTools
+{
+class FObjectOutlinerReport;
+
+struct FObjectOutlinerPackageExport
+{
+	FName ObjectName;
+	FName ClassName;
+	// Export index of the outer, INDEX_NONE for top level exports
+	int32 OuterExportIndex = INDEX_NONE;
+	int64 SerialSize = 0;
+	int64 BulkDataSize = 0;
+	bool bIsAsset = false;
+};
+
+struct FObjectOutlinerPackageInfo
+{
+	FString Filename;
+	FString Error;
+	int32 ImportNum = 0;
+	int64 FileSize = 0;
+	int64 TotalHeaderSize = 0;
+	TArray<FObjectOutlinerPackageExport> Exports;
+};
+
+/**
+ * Reads package summary, name, import, export and data resource tables of uncooked .uasset/.umap files straight from disk.
+ * No linker, no UObjects are created, only names are added to the name table.
+ * Files are memory mapped so only pages holding the tables are actually read, packages are parsed in parallel.
+ */
+class FObjectOutlinerPackageInspector
+{
+public:
+	static void ReadPackages(const TArray<FString>& Filenames, TArray<FObjectOutlinerPackageInfo>& OutPackages);
+	static FObjectOutlinerPackageInfo ReadPackage(const FString& Filename);
+
+	// Packages with their exports nested by outer
+	static TSharedRef<FObjectOutlinerReport> MakeReport(const TArray<FObjectOutlinerPackageInfo>& Packages);
+
+	// Ask for package files and show report for them
+	static void PickAndInspectPackages(const TSharedPtr<const SWidget>& ParentWidget);
+
+private:
+	static void ReadTables(TConstArrayView<uint8> Data, FObjectOutlinerPackageInfo& OutInfo);
+};
+}
@@ -0,0 +1,539 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerPopulationTracker.h"
+
+#include "HazardTools.h"
+#include "HazardToolsUtils.h"
+#include "Engine/World.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+
+namespace HazardTools
+{
+namespace PopulationTracker
+{
+// Queued indices are resolved at least this often, so queues stay small while nobody queries the tracker
+constexpr float MergeInterval = 1.f;
+}
+
+TUniquePtr<FObjectOutlinerPopulationTracker> FObjectOutlinerPopulationTracker::Instance;
+std::atomic<uint32> FObjectOutlinerPopulationTracker::Generation{0};
+
+void FObjectOutlinerPopulationTracker::Startup()
+{
+	check(IsInGameThread());
+	if (Instance.IsValid() == false)
+	{
+		Instance = TUniquePtr<FObjectOutlinerPopulationTracker>(new FObjectOutlinerPopulationTracker());
+		Instance->Register();
+	}
+}
+
+void FObjectOutlinerPopulationTracker::Shutdown()
+{
+	Instance.Reset();
+}
+
+FObjectOutlinerPopulationTracker::FObjectOutlinerPopulationTracker()
+{
+	CountedBits.Init(GUObjectArray.GetObjectArrayCapacity());
+	TransientBits.Init(GUObjectArray.GetObjectArrayCapacity());
+	TransientPackage = GetTransientPackage();
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FObjectOutlinerPopulationTracker::HandleTick), PopulationTracker::MergeInterval);
+}
+
+FObjectOutlinerPopulationTracker::~FObjectOutlinerPopulationTracker()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	Unregister();
+	Generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FObjectOutlinerPopulationTracker::Register()
+{
+	GUObjectArray.AddUObjectCreateListener(this);
+	GUObjectArray.AddUObjectDeleteListener(this);
+	bRegistered = true;
+}
+
+void FObjectOutlinerPopulationTracker::Seed() const
+{
+	check(IsInGameThread());
+	if (bSeeded)
+	{
+		return;
+	}
+	bSeeded = true;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerPopulationTracker::Seed);
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Listeners were registered first. Objects created meanwhile may be reported by listener too,
+	// counted and transient bits make whichever comes second a no-op, objects deleted before being seeded are skipped by listener the same way
+	int32 SeededNum = 0;
+	for (FThreadSafeObjectIterator It; It; ++It)
+	{
+		const int32 Index = GUObjectArray.ObjectToIndex(*It);
+		if (IsInTransientPackage(*It) && TransientBits.Set(Index))
+		{
+			FTransientCounts& Counts = TransientCounts.FindOrAdd(It->GetClass());
+			Counts.ClassName = It->GetClass()->GetFName();
+			Counts.SeededNum++;
+		}
+		if (CountedBits.Set(Index) == false)
+		{
+			continue;
+		}
+
+		FClassCount& ClassCount = ClassCounts.FindOrAdd(It->GetClass());
+		ClassCount.ClassName = It->GetClass()->GetFName();
+		ClassCount.Num++;
+		AddToWorldIndex(Index, *It);
+		SeededNum++;
+	}
+	TotalNum.fetch_add(SeededNum, std::memory_order_relaxed);
+
+	UE_LOG(LogHazardTools, Log, TEXT("Object population seeded: %d objects, %d classes, %d worlds in %.2f s"), SeededNum, ClassCounts.Num(), WorldObjectIndices.Num(), FPlatformTime::Seconds() - StartTime);
+}
+
+void FObjectOutlinerPopulationTracker::Unregister()
+{
+	if (bRegistered)
+	{
+		GUObjectArray.RemoveUObjectCreateListener(this);
+		GUObjectArray.RemoveUObjectDeleteListener(this);
+		bRegistered = false;
+	}
+}
+
+FObjectOutlinerPopulationTracker::FThreadCounters& FObjectOutlinerPopulationTracker::GetThreadCounters()
+{
+	thread_local FThreadCounters* CachedCounters = nullptr;
+	thread_local uint32 CachedGeneration = 0;
+
+	const uint32 CurrentGeneration = Generation.load(std::memory_order_relaxed);
+	if (CachedCounters == nullptr || CachedGeneration != CurrentGeneration)
+	{
+		FScopeLock Lock(&ThreadCountersLock);
+		CachedCounters = ThreadCounters.Add_GetRef(MakeUnique<FThreadCounters>()).Get();
+		CachedGeneration = CurrentGeneration;
+	}
+	return *CachedCounters;
+}
+
+void FObjectOutlinerPopulationTracker::FObjectIndexBits::Init(const int32 InCapacity)
+{
+	Capacity = InCapacity;
+	const int32 WordsNum = FMath::DivideAndRoundUp(Capacity, 64);
+	Words = MakeUnique<std::atomic<uint64>[]>(WordsNum);
+	for (int32 WordIndex = 0; WordIndex < WordsNum; ++WordIndex)
+	{
+		Words[WordIndex].store(0, std::memory_order_relaxed);
+	}
+}
+
+bool FObjectOutlinerPopulationTracker::FObjectIndexBits::Set(const int32 Index) const
+{
+	if (Index < 0 || Index >= Capacity)
+	{
+		return false;
+	}
+	const uint64 Mask = 1ull << (Index % 64);
+	return (Words[Index / 64].fetch_or(Mask, std::memory_order_acq_rel) & Mask) == 0;
+}
+
+bool FObjectOutlinerPopulationTracker::FObjectIndexBits::Clear(const int32 Index) const
+{
+	if (Index < 0 || Index >= Capacity)
+	{
+		return false;
+	}
+	const uint64 Mask = 1ull << (Index % 64);
+	return (Words[Index / 64].fetch_and(~Mask, std::memory_order_acq_rel) & Mask) != 0;
+}
+
+bool FObjectOutlinerPopulationTracker::FObjectIndexBits::IsSet(const int32 Index) const
+{
+	if (Index < 0 || Index >= Capacity)
+	{
+		return false;
+	}
+	return (Words[Index / 64].load(std::memory_order_acquire) & (1ull << (Index % 64))) != 0;
+}
+
+bool FObjectOutlinerPopulationTracker::IsInTransientPackage(const UObjectBase* Object) const
+{
+	const UObjectBase* Outermost = Object;
+	while (Outermost->GetOuter() != nullptr)
+	{
+		Outermost = Outermost->GetOuter();
+	}
+	return Outermost == TransientPackage && Object != TransientPackage;
+}
+
+void FObjectOutlinerPopulationTracker::NotifyUObjectCreated(const UObjectBase* Object, const int32 Index)
+{
+	// Transient bit is set before counted bit, a counted object has its membership resolved (see FindTransientRenames)
+	const bool bTransient = IsInTransientPackage(Object) && TransientBits.Set(Index);
+	const bool bCounted = CountedBits.Set(Index);
+	if (bTransient == false && bCounted == false)
+	{
+		return; // Already seeded
+	}
+
+	FThreadCounters& Counters = GetThreadCounters();
+	FScopeLock Lock(&Counters.Lock);
+	if (bTransient)
+	{
+		FTransientCounts& TransientDelta = Counters.TransientDeltas.FindOrAdd(Object->GetClass());
+		TransientDelta.ClassName = Object->GetClass()->GetFName();
+		TransientDelta.CreatedNum++;
+	}
+	if (bCounted)
+	{
+		TotalNum.fetch_add(1, std::memory_order_relaxed);
+		FClassCount& ClassDelta = Counters.ClassDeltas.FindOrAdd(Object->GetClass());
+		ClassDelta.ClassName = Object->GetClass()->GetFName();
+		ClassDelta.Num++;
+		Counters.CreatedIndices.Add(Index);
+	}
+}
+
+void FObjectOutlinerPopulationTracker::NotifyUObjectDeleted(const UObjectBase* Object, const int32 Index)
+{
+	// Outers may be already destroyed, membership was resolved at creation or by last rename scan
+	const bool bTransient = TransientBits.Clear(Index);
+	if (CountedBits.Clear(Index) == false)
+	{
+		return; // Deleted before seeding reached it
+	}
+
+	TotalNum.fetch_sub(1, std::memory_order_relaxed);
+
+	if (bHasFingerprint.load(std::memory_order_acquire))
+	{
+		FingerprintBits.Clear(Index);
+	}
+
+	// Class pointer is only used as a key and never dereferenced here, outers may be already destroyed so world is resolved by index
+	FThreadCounters& Counters = GetThreadCounters();
+	FScopeLock Lock(&Counters.Lock);
+	Counters.ClassDeltas.FindOrAdd(Object->GetClass()).Num--;
+	Counters.DeletedIndices.Add(Index);
+	if (bTransient)
+	{
+		Counters.TransientDeltas.FindOrAdd(Object->GetClass()).DeletedNum++;
+	}
+}
+
+void FObjectOutlinerPopulationTracker::OnUObjectArrayShutdown()
+{
+	Unregister();
+}
+
+bool FObjectOutlinerPopulationTracker::HandleTick(float /*DeltaTime*/)
+{
+	if (bSeeded == false && FHazardToolsUtils::IsEditorIdle())
+	{
+		Seed();
+	}
+	MergeThreadCounters();
+	return true; // Keep ticking
+}
+
+void FObjectOutlinerPopulationTracker::AddToWorldIndex(const int32 Index, const UObjectBase* Object) const
+{
+	if (const UObjectBase* World = FindOuterWorld(Object))
+	{
+		const FObjectKey WorldKey(static_cast<const UObject*>(World));
+		WorldObjectIndices.FindOrAdd(WorldKey).Add(Index);
+		ObjectIndexToWorld.Add(Index, WorldKey);
+	}
+}
+
+void FObjectOutlinerPopulationTracker::MergeThreadCounters() const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerPopulationTracker::MergeThreadCounters);
+	check(IsInGameThread());
+
+	// Sum all threads first, one thread may see deletes of objects created on another
+	FClassCounts ClassDeltas;
+	TArray<int32> CreatedIndices;
+	TArray<int32> DeletedIndices;
+	{
+		FScopeLock Lock(&ThreadCountersLock);
+		for (const TUniquePtr<FThreadCounters>& Counters : ThreadCounters)
+		{
+			FScopeLock ThreadLock(&Counters->Lock);
+			for (const TPair<const UObjectBase*, FClassCount>& Pair : Counters->ClassDeltas)
+			{
+				FClassCount& ClassDelta = ClassDeltas.FindOrAdd(Pair.Key);
+				ClassDelta.ClassName = Pair.Value.ClassName.IsNone() ? ClassDelta.ClassName : Pair.Value.ClassName;
+				ClassDelta.Num += Pair.Value.Num;
+			}
+			for (const TPair<const UObjectBase*, FTransientCounts>& Pair : Counters->TransientDeltas)
+			{
+				FTransientCounts& Counts = TransientCounts.FindOrAdd(Pair.Key);
+				Counts.ClassName = Pair.Value.ClassName.IsNone() ? Counts.ClassName : Pair.Value.ClassName;
+				Counts.CreatedNum += Pair.Value.CreatedNum;
+				Counts.DeletedNum += Pair.Value.DeletedNum;
+			}
+			CreatedIndices.Append(Counters->CreatedIndices);
+			DeletedIndices.Append(Counters->DeletedIndices);
+			Counters->ClassDeltas.Reset();
+			Counters->TransientDeltas.Reset();
+			Counters->CreatedIndices.Reset();
+			Counters->DeletedIndices.Reset();
+		}
+	}
+
+	for (const TPair<const UObjectBase*, FClassCount>& Pair : ClassDeltas)
+	{
+		FClassCount& ClassCount = ClassCounts.FindOrAdd(Pair.Key);
+		ClassCount.ClassName = Pair.Value.ClassName.IsNone() ? ClassCount.ClassName : Pair.Value.ClassName;
+		ClassCount.Num += Pair.Value.Num;
+		if (ClassCount.Num <= 0)
+		{
+			ClassCounts.Remove(Pair.Key);
+		}
+	}
+
+	// Deletes go first: an index deleted and reused since last merge is then resolved again from its current object
+	for (const int32 Index : DeletedIndices)
+	{
+		FObjectKey WorldKey;
+		if (ObjectIndexToWorld.RemoveAndCopyValue(Index, WorldKey))
+		{
+			if (TSet<int32>* Indices = WorldObjectIndices.Find(WorldKey))
+			{
+				Indices->Remove(Index);
+			}
+		}
+	}
+
+	for (const int32 Index : CreatedIndices)
+	{
+		const FUObjectItem* Item = GUObjectArray.IndexToObject(Index);
+		if (Item != nullptr && Item->GetObject() != nullptr && Item->IsUnreachable() == false && ObjectIndexToWorld.Contains(Index) == false)
+		{
+			AddToWorldIndex(Index, Item->GetObject());
+		}
+	}
+
+	// Drop destroyed worlds together with objects still mapped to them
+	for (auto It = WorldObjectIndices.CreateIterator(); It; ++It)
+	{
+		if (It->Key.ResolveObjectPtr() == nullptr)
+		{
+			for (const int32 Index : It->Value)
+			{
+				ObjectIndexToWorld.Remove(Index);
+			}
+			It.RemoveCurrent();
+		}
+	}
+}
+
+int32 FObjectOutlinerPopulationTracker::GetTotalNum() const
+{
+	Seed();
+	return TotalNum.load(std::memory_order_relaxed);
+}
+
+const UObjectBase* FObjectOutlinerPopulationTracker::FindOuterWorld(const UObjectBase* Object)
+{
+	static const UClass* WorldClass = UWorld::StaticClass();
+	for (const UObjectBase* It = Object; It != nullptr; It = It->GetOuter())
+	{
+		if (It->GetClass()->IsChildOf(WorldClass))
+		{
+			return It;
+		}
+	}
+	return nullptr;
+}
+
+void FObjectOutlinerPopulationTracker::CaptureFingerprint()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerPopulationTracker::CaptureFingerprint);
+	check(IsInGameThread());
+
+	if (FingerprintBits.Words.IsValid() == false)
+	{
+		FingerprintBits.Init(GUObjectArray.GetObjectArrayCapacity());
+	}
+
+	// Objects are only deleted by GC purge, which may run on another thread but only destroys unreachable objects.
+	// Those are left out here, so a delete racing with capture can't leave a stale bit behind.
+	// Array does not shrink, words past its current end were never set and objects created there are new by definition.
+	const int32 ObjectArrayNum = FMath::Min(GUObjectArray.GetObjectArrayNum(), FingerprintBits.Capacity);
+	for (int32 WordIndex = 0; WordIndex * 64 < ObjectArrayNum; ++WordIndex)
+	{
+		uint64 Word = 0;
+		const int32 EndIndex = FMath::Min(WordIndex * 64 + 64, ObjectArrayNum);
+		for (int32 Index = WordIndex * 64; Index < EndIndex; ++Index)
+		{
+			const FUObjectItem* Item = GUObjectArray.IndexToObjectUnsafeForGC(Index);
+			if (Item != nullptr && Item->GetObject() != nullptr && Item->IsUnreachable() == false)
+			{
+				Word |= 1ull << (Index % 64);
+			}
+		}
+		FingerprintBits.Words[WordIndex].store(Word, std::memory_order_relaxed);
+	}
+
+	bHasFingerprint.store(true, std::memory_order_release);
+}
+
+void FObjectOutlinerPopulationTracker::ResetFingerprint()
+{
+	// Bits are left as they are and overwritten by next capture
+	bHasFingerprint.store(false, std::memory_order_relaxed);
+}
+
+bool FObjectOutlinerPopulationTracker::HasFingerprint() const
+{
+	return bHasFingerprint.load(std::memory_order_relaxed);
+}
+
+void FObjectOutlinerPopulationTracker::GetObjectsCreatedSinceFingerprint(TArray<UObject*>& OutObjects) const
+{
+	check(IsInGameThread());
+
+	const int32 ObjectArrayNum = GUObjectArray.GetObjectArrayNum();
+	for (int32 Index = 0; Index < ObjectArrayNum; ++Index)
+	{
+		if (FingerprintBits.IsSet(Index))
+		{
+			continue;
+		}
+		const FUObjectItem* Item = GUObjectArray.IndexToObject(Index);
+		if (Item != nullptr && Item->GetObject() != nullptr && Item->IsUnreachable() == false)
+		{
+			OutObjects.Add(static_cast<UObject*>(Item->GetObject()));
+		}
+	}
+}
+
+void FObjectOutlinerPopulationTracker::GetWorldObjectIndices(const UWorld* World, TArray<int32>& OutIndices) const
+{
+	Seed();
+	MergeThreadCounters();
+	if (const TSet<int32>* Indices = WorldObjectIndices.Find(FObjectKey(World)))
+	{
+		OutIndices.Reserve(OutIndices.Num() + Indices->Num());
+		for (const int32 Index : *Indices)
+		{
+			OutIndices.Add(Index);
+		}
+	}
+}
+
+int32 FObjectOutlinerPopulationTracker::GetWorldObjectsNum(const UWorld* World) const
+{
+	Seed();
+	MergeThreadCounters();
+	const TSet<int32>* Indices = WorldObjectIndices.Find(FObjectKey(World));
+	return Indices != nullptr ? Indices->Num() : 0;
+}
+
+void FObjectOutlinerPopulationTracker::GetTopClasses(const int32 Num, TArray<TPair<FName, int32>>& OutTopClasses) const
+{
+	OutTopClasses.Reset();
+	if (Num <= 0)
+	{
+		return;
+	}
+
+	// Bounded min-heap, top is the smallest of currently selected classes
+	const auto HeapPredicate = [](const FClassCount& A, const FClassCount& B) { return A.Num < B.Num; };
+	TArray<FClassCount, TInlineAllocator<32>> Heap;
+	Heap.Reserve(Num + 1);
+
+	Seed();
+	MergeThreadCounters();
+
+	for (const TPair<const UObjectBase*, FClassCount>& Pair : ClassCounts)
+	{
+		if (Heap.Num() < Num)
+		{
+			Heap.HeapPush(Pair.Value, HeapPredicate);
+		}
+		else if (Pair.Value.Num > Heap.HeapTop().Num)
+		{
+			Heap.HeapPopDiscard(HeapPredicate, EAllowShrinking::No);
+			Heap.HeapPush(Pair.Value, HeapPredicate);
+		}
+	}
+
+	OutTopClasses.Reserve(Heap.Num());
+	for (const FClassCount& ClassCount : Heap)
+	{
+		OutTopClasses.Emplace(ClassCount.ClassName, ClassCount.Num);
+	}
+	OutTopClasses.Sort([](const TPair<FName, int32>& A, const TPair<FName, int32>& B) { return A.Value > B.Value; });
+}
+
+void FObjectOutlinerPopulationTracker::ConsumeTransientCounts(FTransientCountsMap& OutCounts)
+{
+	// No seeding here, created and deleted counts don't depend on it and seeded objects are added whenever it happens
+	MergeThreadCounters();
+
+	for (const TPair<const UObjectBase*, FTransientCounts>& Pair : TransientCounts)
+	{
+		FTransientCounts& Counts = OutCounts.FindOrAdd(Pair.Key);
+		Counts.ClassName = Pair.Value.ClassName.IsNone() ? Counts.ClassName : Pair.Value.ClassName;
+		Counts.SeededNum += Pair.Value.SeededNum;
+		Counts.CreatedNum += Pair.Value.CreatedNum;
+		Counts.DeletedNum += Pair.Value.DeletedNum;
+	}
+	TransientCounts.Reset();
+}
+
+void FObjectOutlinerPopulationTracker::FindTransientRenames(FTransientCountsMap& OutCounts)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerPopulationTracker::FindTransientRenames);
+	check(IsInGameThread());
+	Seed();
+
+	// Renamed out: marked objects whose outermost is not transient package anymore
+	const int32 ObjectArrayNum = FMath::Min(GUObjectArray.GetObjectArrayNum(), TransientBits.Capacity);
+	for (int32 WordIndex = 0; WordIndex * 64 < ObjectArrayNum; ++WordIndex)
+	{
+		uint64 Word = TransientBits.Words[WordIndex].load(std::memory_order_acquire);
+		while (Word != 0)
+		{
+			const int32 Index = WordIndex * 64 + FMath::CountTrailingZeros64(Word);
+			Word &= Word - 1;
+
+			const FUObjectItem* Item = GUObjectArray.IndexToObject(Index);
+			if (Item == nullptr || Item->GetObject() == nullptr || Item->IsUnreachable())
+			{
+				continue; // Delete listener takes care of it
+			}
+
+			const UObjectBase* Object = Item->GetObject();
+			if (IsInTransientPackage(Object) == false && TransientBits.Clear(Index))
+			{
+				FTransientCounts& Counts = OutCounts.FindOrAdd(Object->GetClass());
+				Counts.ClassName = Object->GetClass()->GetFName();
+				Counts.RenamedOutNum++;
+			}
+		}
+	}
+
+	// Renamed in: counted objects inside transient package without a bit. Objects not counted yet are still being created
+	// on another thread, create listener sets their bit and counts them as created
+	ForEachObjectWithOuter(TransientPackage, [&](UObject* Object)
+	{
+		const int32 Index = GUObjectArray.ObjectToIndex(Object);
+		if (Object->IsUnreachable() == false && CountedBits.IsSet(Index) && TransientBits.Set(Index))
+		{
+			FTransientCounts& Counts = OutCounts.FindOrAdd(Object->GetClass());
+			Counts.ClassName = Object->GetClass()->GetFName();
+			Counts.RenamedInNum++;
+		}
+	}, true);
+}
+}
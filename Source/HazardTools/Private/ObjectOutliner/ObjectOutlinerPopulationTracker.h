@@ -0,0 +1,170 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectArray.h"
+
+#include <atomic>
+
+namespace HazardTools
+{
+/**
+ * Keeps live object counters up to date from GUObjectArray create/delete notifications,
+ * so tools can query population per class without rescanning the whole object array.
+ *
+ * Listener callbacks may come from any thread (async loading, GC purge). Each thread increments its own class counters
+ * (lock is uncontended, only taken by game thread when counters are merged), a lock free bit per object index tells
+ * which objects are counted, so objects seen by both seeding and listeners are counted once.
+ * Objects created before startup are seeded once, on first query or first idle tick, so editor startup doesn't pay for a scan.
+ * Class pointers are keys only and never dereferenced, class may be purged before its last instances.
+ * Class names are copied when an instance is created or seeded, while class is known to be alive.
+ *
+ * Also keeps index of objects per UWorld. Listeners only queue created and deleted indices, outer chains are resolved
+ * on game thread when queues are merged (periodically and on query). Worlds are keyed by FObjectKey and dropped once destroyed.
+ * Objects renamed into other world after being indexed are not moved.
+ *
+ * Transient package membership is another bit per object index, set when object is created there and read back on delete,
+ * when outer chain can't be walked anymore. Renames into or out of transient package are only found on request.
+ */
+class FObjectOutlinerPopulationTracker : public FUObjectArray::FUObjectCreateListener, public FUObjectArray::FUObjectDeleteListener
+{
+public:
+	static void Startup();
+	static void Shutdown();
+
+	// Null if tracking is not running (commandlet or disabled in settings)
+	static FObjectOutlinerPopulationTracker* Get() { return Instance.Get(); }
+
+	virtual ~FObjectOutlinerPopulationTracker() override;
+
+	// FUObjectCreateListener/FUObjectDeleteListener interface
+	virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+	virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override;
+	virtual void OnUObjectArrayShutdown() override;
+
+	// Game thread only: number of live objects
+	[[nodiscard]] int32 GetTotalNum() const;
+
+	// Game thread only, cheap enough to call every few seconds: fill OutTopClasses with at most Num class names with biggest instance count, sorted descending
+	void GetTopClasses(int32 Num, TArray<TPair<FName, int32>>& OutTopClasses) const;
+
+	// Game thread only: GUObjectArray indices of objects created inside World, caller should validate them
+	void GetWorldObjectIndices(const UWorld* World, TArray<int32>& OutIndices) const;
+	[[nodiscard]] int32 GetWorldObjectsNum(const UWorld* World) const;
+
+	// First UWorld in outer chain including object itself
+	static const UObjectBase* FindOuterWorld(const UObjectBase* Object);
+
+	// Transient package population changes of one class
+	struct FTransientCounts
+	{
+		FName ClassName;
+		// Already inside transient package when population was seeded
+		int32 SeededNum = 0;
+		int32 CreatedNum = 0;
+		int32 DeletedNum = 0;
+		int32 RenamedInNum = 0;
+		int32 RenamedOutNum = 0;
+
+		[[nodiscard]] int32 GetEnteredNum() const { return CreatedNum + RenamedInNum; }
+		[[nodiscard]] int32 GetLeftNum() const { return DeletedNum + RenamedOutNum; }
+	};
+
+	// Keyed by class pointer, which is never dereferenced
+	using FTransientCountsMap = TMap<const UObjectBase*, FTransientCounts>;
+
+	// Game thread only: add transient package changes since previous call to OutCounts
+	void ConsumeTransientCounts(FTransientCountsMap& OutCounts);
+
+	/**
+	 * Game thread only: sync transient membership with current outers and add renames since previous call to OutCounts.
+	 * Walks the whole transient package. Objects which moved and were destroyed in between count where they were created.
+	 */
+	void FindTransientRenames(FTransientCountsMap& OutCounts);
+
+	/**
+	 * Game thread only: remember live object indices as a bit per GUObjectArray slot. Delete listener clears the bit without locking,
+	 * so later a set bit means object existed at capture time and is still alive, slot reuse reads as a new object.
+	 */
+	void CaptureFingerprint();
+	void ResetFingerprint();
+	[[nodiscard]] bool HasFingerprint() const;
+
+	// Game thread only: objects created after CaptureFingerprint() which are still alive
+	void GetObjectsCreatedSinceFingerprint(TArray<UObject*>& OutObjects) const;
+
+private:
+	struct FClassCount
+	{
+		// None in deltas which only delete instances
+		FName ClassName;
+		int32 Num = 0;
+	};
+
+	using FClassCounts = TMap<const UObjectBase*, FClassCount>;
+
+	// Bit per GUObjectArray slot, sized once for the whole object array so bits can be flipped from any thread without locking
+	struct FObjectIndexBits
+	{
+		TUniquePtr<std::atomic<uint64>[]> Words;
+		int32 Capacity = 0;
+
+		void Init(int32 InCapacity);
+		// Both return true if bit was changed
+		bool Set(int32 Index) const;
+		bool Clear(int32 Index) const;
+		[[nodiscard]] bool IsSet(int32 Index) const;
+	};
+
+	struct FThreadCounters
+	{
+		FCriticalSection Lock;
+		FClassCounts ClassDeltas;
+		FTransientCountsMap TransientDeltas;
+		TArray<int32> CreatedIndices;
+		TArray<int32> DeletedIndices;
+	};
+
+	FObjectOutlinerPopulationTracker();
+
+	void Register();
+	void Unregister();
+	// Game thread only: count objects created before listeners were registered, first call only
+	void Seed() const;
+
+	FThreadCounters& GetThreadCounters();
+	bool IsInTransientPackage(const UObjectBase* Object) const;
+
+	// Fold per thread deltas into ClassCounts (zero entries are removed) and queued indices into world index
+	void MergeThreadCounters() const;
+	bool HandleTick(float DeltaTime);
+	void AddToWorldIndex(int32 Index, const UObjectBase* Object) const;
+
+	static TUniquePtr<FObjectOutlinerPopulationTracker> Instance;
+	// Invalidates thread local counters of previous instance
+	static std::atomic<uint32> Generation;
+
+	FObjectIndexBits CountedBits;
+	FObjectIndexBits TransientBits;
+	const UObjectBase* TransientPackage = nullptr;
+
+	mutable FCriticalSection ThreadCountersLock;
+	TArray<TUniquePtr<FThreadCounters>> ThreadCounters;
+	// Game thread only, merged from ThreadCounters
+	mutable FClassCounts ClassCounts;
+	mutable FTransientCountsMap TransientCounts;
+	mutable TMap<FObjectKey, TSet<int32>> WorldObjectIndices;
+	mutable TMap<int32, FObjectKey> ObjectIndexToWorld;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	std::atomic<int32> TotalNum{0};
+	// Allocated on first capture
+	FObjectIndexBits FingerprintBits;
+	std::atomic<bool> bHasFingerprint{false};
+	bool bRegistered = false;
+	mutable bool bSeeded = false;
+};
+}
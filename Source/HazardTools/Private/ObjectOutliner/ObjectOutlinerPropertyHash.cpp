@@ -0,0 +1,119 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerPropertyHash.h"
+
+#include "UObject/TextProperty.h"
+
+namespace HazardTools
+{
+uint32 FObjectOutlinerPropertyHash::HashProperty(const FProperty* Property, const void* ContainerPtr, uint32 Seed)
+{
+	for (int32 ArrayIndex = 0; ArrayIndex < Property->GetArrayDim(); ++ArrayIndex)
+	{
+		Seed = HashValue(Property, Property->ContainerPtrToValuePtr<void>(ContainerPtr, ArrayIndex), Seed);
+	}
+	return Seed;
+}
+
+uint32 FObjectOutlinerPropertyHash::HashValue(const FProperty* Property, const void* ValuePtr, const uint32 Seed)
+{
+	// Bitfield bools share memory with neighbours, must be checked before raw memory path
+	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		return HashCombineFast(Seed, BoolProperty->GetPropertyValue(ValuePtr) ? 1u : 0u);
+	}
+
+	if (Property->HasAnyPropertyFlags(CPF_IsPlainOldData))
+	{
+		return FCrc::MemCrc32(ValuePtr, Property->GetElementSize(), Seed);
+	}
+
+	if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+	{
+		return FCrc::StrCrc32(*StrProperty->GetPropertyValue(ValuePtr), Seed);
+	}
+
+	if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+	{
+		return FCrc::StrCrc32(*TextProperty->GetPropertyValue(ValuePtr).ToString(), Seed);
+	}
+
+	if (const FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(Property))
+	{
+		return HashCombineFast(Seed, GetTypeHash(SoftObjectProperty->GetPropertyValue(ValuePtr).ToSoftObjectPath()));
+	}
+
+	if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+	{
+		return HashCombineFast(Seed, PointerHash(ObjectProperty->GetObjectPropertyValue(ValuePtr)));
+	}
+
+	if (const FInterfaceProperty* InterfaceProperty = CastField<FInterfaceProperty>(Property))
+	{
+		return HashCombineFast(Seed, PointerHash(InterfaceProperty->GetPropertyValue(ValuePtr).GetObject()));
+	}
+
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		uint32 Hash = Seed;
+		for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+		{
+			if (IsHashable(*It))
+			{
+				Hash = HashProperty(*It, ValuePtr, Hash);
+			}
+		}
+		return Hash;
+	}
+
+	if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		const FScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+		uint32 Hash = HashCombineFast(Seed, Helper.Num());
+		if (ArrayProperty->Inner->HasAnyPropertyFlags(CPF_IsPlainOldData) && CastField<FBoolProperty>(ArrayProperty->Inner) == nullptr)
+		{
+			// Contiguous POD elements, one pass over the whole allocation
+			return FCrc::MemCrc32(Helper.GetRawPtr(), Helper.Num() * ArrayProperty->Inner->GetElementSize(), Hash);
+		}
+		for (int32 Index = 0; Index < Helper.Num(); ++Index)
+		{
+			Hash = HashValue(ArrayProperty->Inner, Helper.GetRawPtr(Index), Hash);
+		}
+		return Hash;
+	}
+
+	if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		const FScriptSetHelper Helper(SetProperty, ValuePtr);
+		uint32 Hash = HashCombineFast(Seed, Helper.Num());
+		for (FScriptSetHelper::FIterator It(Helper); It; ++It)
+		{
+			Hash = HashValue(SetProperty->ElementProp, Helper.GetElementPtr(It), Hash);
+		}
+		return Hash;
+	}
+
+	if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		const FScriptMapHelper Helper(MapProperty, ValuePtr);
+		uint32 Hash = HashCombineFast(Seed, Helper.Num());
+		for (FScriptMapHelper::FIterator It(Helper); It; ++It)
+		{
+			Hash = HashValue(MapProperty->KeyProp, Helper.GetKeyPtr(It), Hash);
+			Hash = HashValue(MapProperty->ValueProp, Helper.GetValuePtr(It), Hash);
+		}
+		return Hash;
+	}
+
+	// Rare types (field paths, optionals, verse values), slow but correct
+	FString ValueText;
+	Property->ExportTextItem_Direct(ValueText, ValuePtr, nullptr, nullptr, PPF_None);
+	return FCrc::StrCrc32(*ValueText, Seed);
+}
+
+bool FObjectOutlinerPropertyHash::IsHashable(const FProperty* Property)
+{
+	return Property->IsA<FDelegateProperty>() == false
+	       && Property->IsA<FMulticastDelegateProperty>() == false;
+}
+}
@@ -0,0 +1,25 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace HazardTools
+{
+/**
+ * Hashes property values directly from memory using reflected layout, no text export.
+ * Plain old data is hashed as raw bytes, strings, containers and structs recurse into their elements.
+ * Object references are hashed by pointer, not by referenced object content.
+ */
+struct FObjectOutlinerPropertyHash
+{
+	// Hash of Property value (all static array elements) inside ContainerPtr (object or struct memory)
+	static uint32 HashProperty(const FProperty* Property, const void* ContainerPtr, uint32 Seed = 0);
+
+	// Hash of a single element at ValuePtr
+	static uint32 HashValue(const FProperty* Property, const void* ValuePtr, uint32 Seed = 0);
+
+	// Delegates are bindings rather than state, they are not worth hashing
+	static bool IsHashable(const FProperty* Property);
+};
+}
@@ -0,0 +1,160 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerPropertyQuery.h"
+
+#include "Async/ParallelFor.h"
+#include "Misc/StringOutputDevice.h"
+#include "UObject/UObjectHash.h"
+
+namespace HazardTools
+{
+FObjectOutlinerPropertyQuery::FObjectOutlinerPropertyQuery(UClass* InClass, const FProperty* InProperty)
+	: Class(InClass)
+	, Property(InProperty)
+{
+	check(InClass != nullptr && InProperty != nullptr);
+
+	PropertyName = Property->GetFName();
+	PropertyOffset = Property->GetOffset_ForInternal();
+
+	ValueBuffer = static_cast<uint8*>(FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment()));
+	Property->InitializeValue(ValueBuffer);
+}
+
+FObjectOutlinerPropertyQuery::~FObjectOutlinerPropertyQuery()
+{
+	// Property is owned by the class, don't touch it if class was recompiled, buffer may leak inner allocations in that case
+	if (IsValid())
+	{
+		Property->DestroyValue(ValueBuffer);
+	}
+	FMemory::Free(ValueBuffer);
+}
+
+bool FObjectOutlinerPropertyQuery::SetValueText(const FString& InValueText, FText& OutError)
+{
+	if (IsValid() == false)
+	{
+		OutError = INVTEXT("Class or property no longer exists");
+		return false;
+	}
+
+	ValueText = InValueText;
+	bHasValue = false;
+
+	Property->ClearValue(ValueBuffer);
+
+	FStringOutputDevice ImportErrors;
+	if (Property->ImportText_Direct(*InValueText, ValueBuffer, nullptr, PPF_None, &ImportErrors) != nullptr)
+	{
+		bHasValue = true;
+	}
+	else if (ImportEnumValueByDisplayName(InValueText))
+	{
+		bHasValue = true;
+	}
+
+	if (bHasValue == false)
+	{
+		OutError = ImportErrors.IsEmpty()
+			           ? FText::Format(INVTEXT("Can't parse \"{0}\" as {1}"), FText::FromString(InValueText), FText::FromString(Property->GetCPPType()))
+			           : FText::FromString(ImportErrors);
+	}
+	return bHasValue;
+}
+
+bool FObjectOutlinerPropertyQuery::ImportEnumValueByDisplayName(const FString& InValueText)
+{
+	// Allow "UI" for TEXTUREGROUP_UI and similar, ImportText only accepts authored names
+	const UEnum* Enum = nullptr;
+	if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+	{
+		Enum = ByteProperty->Enum;
+	}
+	else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	{
+		Enum = EnumProperty->GetEnum();
+	}
+
+	if (Enum == nullptr)
+	{
+		return false;
+	}
+
+	// Last entry is autogenerated _MAX
+	for (int32 EnumIndex = 0; EnumIndex < Enum->NumEnums() - 1; ++EnumIndex)
+	{
+		if (Enum->GetDisplayNameTextByIndex(EnumIndex).ToString().Equals(InValueText, ESearchCase::IgnoreCase)
+		    || Enum->GetNameStringByIndex(EnumIndex).Equals(InValueText, ESearchCase::IgnoreCase))
+		{
+			const int64 Value = Enum->GetValueByIndex(EnumIndex);
+			if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+			{
+				ByteProperty->SetPropertyValue(ValueBuffer, static_cast<uint8>(Value));
+			}
+			else
+			{
+				CastFieldChecked<FEnumProperty>(Property)->GetUnderlyingProperty()->SetIntPropertyValue(ValueBuffer, Value);
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FObjectOutlinerPropertyQuery::IsValid() const
+{
+	return Class.IsValid() && FindFProperty<FProperty>(Class.Get(), PropertyName) == Property;
+}
+
+bool FObjectOutlinerPropertyQuery::Matches(const UObject* Object) const
+{
+	const uint8* ObjectValue = reinterpret_cast<const uint8*>(Object) + PropertyOffset;
+	for (int32 ArrayIndex = 0; ArrayIndex < Property->GetArrayDim(); ++ArrayIndex)
+	{
+		const int32 ElementOffset = ArrayIndex * Property->GetElementSize();
+		if (Property->Identical(ObjectValue + ElementOffset, ValueBuffer + ElementOffset, PPF_None) == false)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FObjectOutlinerPropertyQuery::Execute(TArray<UObject*>& OutMatches) const
+{
+	OutMatches.Reset();
+	if (IsValid() == false || bHasValue == false)
+	{
+		return;
+	}
+
+	// Class hash lookup, no full object array scan
+	TArray<UObject*> Candidates;
+	GetObjectsOfClass(Class.Get(), Candidates, true);
+
+	TArray<bool> Results;
+	Results.SetNumZeroed(Candidates.Num());
+
+	ParallelFor(Candidates.Num(), [&](const int32 Index)
+	{
+		Results[Index] = Matches(Candidates[Index]);
+	});
+
+	for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+	{
+		if (Results[Index])
+		{
+			OutMatches.Add(Candidates[Index]);
+		}
+	}
+}
+
+FText FObjectOutlinerPropertyQuery::GetDescription() const
+{
+	return FText::Format(INVTEXT("{0}.{1} == {2}"),
+		FText::FromString(Class.IsValid() ? Class->GetName() : TEXT("None")),
+		FText::FromName(PropertyName),
+		FText::FromString(ValueText));
+}
+}
@@ -0,0 +1,47 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace HazardTools
+{
+/**
+ * "Instances of Class whose Property equals Value" query.
+ * Value text is imported once into a buffer of the property type, then every candidate is compared
+ * with FProperty::Identical directly on its memory at the precomputed property offset. No per object text export.
+ */
+class FObjectOutlinerPropertyQuery
+{
+public:
+	FObjectOutlinerPropertyQuery(UClass* InClass, const FProperty* InProperty);
+	~FObjectOutlinerPropertyQuery();
+
+	FObjectOutlinerPropertyQuery(const FObjectOutlinerPropertyQuery&) = delete;
+	FObjectOutlinerPropertyQuery& operator=(const FObjectOutlinerPropertyQuery&) = delete;
+
+	// Parse InValueText as property value, on fail OutError describes the problem
+	bool SetValueText(const FString& InValueText, FText& OutError);
+
+	// False if class is gone or property was recreated (e.g. blueprint recompile)
+	[[nodiscard]] bool IsValid() const;
+
+	// All live instances of Class and derived classes which property value equals parsed value. Evaluated in parallel.
+	void Execute(TArray<UObject*>& OutMatches) const;
+
+	[[nodiscard]] FText GetDescription() const;
+
+private:
+	bool ImportEnumValueByDisplayName(const FString& InValueText);
+	bool Matches(const UObject* Object) const;
+
+	TWeakObjectPtr<UClass> Class;
+	const FProperty* Property = nullptr;
+	FName PropertyName;
+	int32 PropertyOffset = 0;
+
+	uint8* ValueBuffer = nullptr;
+	bool bHasValue = false;
+	FString ValueText;
+};
+}
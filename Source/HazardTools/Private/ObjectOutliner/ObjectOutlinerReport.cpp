@@ -0,0 +1,96 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerReport.h"
+
+#include "ObjectOutlinerExport.h"
+
+namespace HazardTools
+{
+FObjectOutlinerReportRow& FObjectOutlinerReportRow::AddChild(const int32 ColumnsNum)
+{
+	const TSharedRef<FObjectOutlinerReportRow> Row = MakeShared<FObjectOutlinerReportRow>();
+	Row->Cells.SetNum(ColumnsNum);
+	Children.Add(Row);
+	return *Row;
+}
+
+int32 FObjectOutlinerReport::AddColumn(const FName Id, const FText& Label, const EObjectOutlinerReportColumnType Type, const float FillWidth)
+{
+	check(Rows.Num() == 0);
+	return Columns.Add({Id, Label, Type, FillWidth});
+}
+
+FObjectOutlinerReportRow& FObjectOutlinerReport::AddRow()
+{
+	const TSharedRef<FObjectOutlinerReportRow> Row = MakeShared<FObjectOutlinerReportRow>();
+	Row->Cells.SetNum(Columns.Num());
+	Rows.Add(Row);
+	return *Row;
+}
+
+FText FObjectOutlinerReport::FormatCell(const FObjectOutlinerReportColumn& Column, const FObjectOutlinerReportCell& Cell)
+{
+	if (Cell.Text.IsEmpty() == false)
+	{
+		return FText::FromString(Cell.Text);
+	}
+
+	switch (Column.Type)
+	{
+		case EObjectOutlinerReportColumnType::Number:
+			return FText::AsNumber(Cell.Value);
+		case EObjectOutlinerReportColumnType::Memory:
+			return FText::AsMemory(Cell.Value, IEC);
+		default:
+			return FText::FromString(Cell.Text);
+	}
+}
+
+bool FObjectOutlinerReport::SaveToCsv(const FString& Filename) const
+{
+	FObjectOutlinerTextFileWriter Writer(Filename);
+	if (Writer.IsOpen() == false)
+	{
+		return false;
+	}
+
+	FStringBuilderBase& Builder = Writer.GetBuilder();
+	Builder.Append(TEXT("Depth"));
+	for (const FObjectOutlinerReportColumn& Column : Columns)
+	{
+		Builder.AppendChar(TEXT(','));
+		FObjectOutlinerTextFileWriter::AppendCsvField(Builder, Column.Label.ToString());
+	}
+	Builder.AppendChar(TEXT('\n'));
+
+	AppendCsvRows(Writer, Rows, 0);
+	Writer.Close();
+	return true;
+}
+
+void FObjectOutlinerReport::AppendCsvRows(FObjectOutlinerTextFileWriter& Writer, const TArray<FObjectOutlinerReportRowPtr>& InRows, const int32 Depth) const
+{
+	FStringBuilderBase& Builder = Writer.GetBuilder();
+	for (const FObjectOutlinerReportRowPtr& Row : InRows)
+	{
+		Builder.Appendf(TEXT("%d"), Depth);
+		for (int32 ColumnIndex = 0; ColumnIndex < Columns.Num(); ++ColumnIndex)
+		{
+			Builder.AppendChar(TEXT(','));
+			const FObjectOutlinerReportCell& Cell = Row->Cells[ColumnIndex];
+			if (Columns[ColumnIndex].Type == EObjectOutlinerReportColumnType::Text || Cell.Text.IsEmpty() == false)
+			{
+				FObjectOutlinerTextFileWriter::AppendCsvField(Builder, Cell.Text);
+			}
+			else
+			{
+				Builder.Appendf(TEXT("%lld"), Cell.Value);
+			}
+		}
+		Builder.AppendChar(TEXT('\n'));
+		Writer.MaybeFlush();
+
+		AppendCsvRows(Writer, Row->Children, Depth + 1);
+	}
+}
+}
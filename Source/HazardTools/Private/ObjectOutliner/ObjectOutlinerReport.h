@@ -0,0 +1,93 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace HazardTools
+{
+class FObjectOutlinerTextFileWriter;
+
+enum class EObjectOutlinerReportColumnType : uint8
+{
+	Text,
+	Number,
+	Memory
+};
+
+struct FObjectOutlinerReportColumn
+{
+	FName Id;
+	FText Label;
+	EObjectOutlinerReportColumnType Type = EObjectOutlinerReportColumnType::Text;
+	float FillWidth = 1.f;
+};
+
+// Text columns use Text, number and memory columns use Value (also used for sorting), or show Text instead when set (e.g. "n/a")
+struct FObjectOutlinerReportCell
+{
+	FString Text;
+	int64 Value = 0;
+};
+
+struct FObjectOutlinerReportRow : TSharedFromThis<FObjectOutlinerReportRow>
+{
+	TArray<FObjectOutlinerReportCell> Cells;
+	TArray<TSharedPtr<FObjectOutlinerReportRow>> Children;
+
+	// Optional object, double click opens its editor
+	TWeakObjectPtr<UObject> Object;
+	FString Tooltip;
+	bool bHighlight = false;
+	// Children are an ordered sequence (e.g. reference chain) and are not sorted by the view
+	bool bKeepChildrenOrder = false;
+
+	FObjectOutlinerReportRow& SetText(const int32 ColumnIndex, FString Text)
+	{
+		Cells[ColumnIndex].Text = MoveTemp(Text);
+		return *this;
+	}
+
+	FObjectOutlinerReportRow& SetValue(const int32 ColumnIndex, const int64 Value)
+	{
+		Cells[ColumnIndex].Value = Value;
+		return *this;
+	}
+
+	FObjectOutlinerReportRow& AddChild(int32 ColumnsNum);
+};
+
+using FObjectOutlinerReportRowPtr = TSharedPtr<FObjectOutlinerReportRow>;
+
+/**
+ * Generic table/tree of results produced by outliner analyses, displayed by SObjectOutlinerReport.
+ * Keeps only plain values and weak object pointers, so a report stays valid after GC.
+ */
+class FObjectOutlinerReport
+{
+public:
+	explicit FObjectOutlinerReport(const FText& InTitle)
+		: Title(InTitle)
+	{
+	}
+
+	int32 AddColumn(FName Id, const FText& Label, EObjectOutlinerReportColumnType Type = EObjectOutlinerReportColumnType::Text, float FillWidth = 1.f);
+	FObjectOutlinerReportRow& AddRow();
+
+	// Write all rows depth first as CSV, nested rows get their depth in the first column
+	bool SaveToCsv(const FString& Filename) const;
+
+	[[nodiscard]] static FText FormatCell(const FObjectOutlinerReportColumn& Column, const FObjectOutlinerReportCell& Cell);
+
+	FText Title;
+	// Free form text displayed above the table
+	FText Summary;
+	TArray<FObjectOutlinerReportColumn> Columns;
+	TArray<FObjectOutlinerReportRowPtr> Rows;
+
+private:
+	void AppendCsvRows(FObjectOutlinerTextFileWriter& Writer, const TArray<FObjectOutlinerReportRowPtr>& InRows, int32 Depth) const;
+};
+
+DECLARE_DELEGATE_RetVal(TSharedPtr<FObjectOutlinerReport>, FObjectOutlinerReportGenerator);
+}
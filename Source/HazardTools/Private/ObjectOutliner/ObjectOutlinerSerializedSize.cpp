@@ -0,0 +1,181 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerSerializedSize.h"
+
+#include "HazardToolsObjectOutlinerSettings.h"
+#include "Serialization/ArchiveUObject.h"
+
+namespace HazardTools
+{
+namespace SerializedSize
+{
+	class FCountingArchive final : public FArchiveUObject
+	{
+	public:
+		FCountingArchive()
+		{
+			SetIsSaving(true);
+		}
+
+		virtual void Serialize(void* /*Data*/, const int64 Num) override
+		{
+			Size += Num;
+		}
+
+		// Saved package stores references and names as table indices
+		virtual FArchive& operator<<(UObject*& /*Object*/) override
+		{
+			Size += sizeof(FPackageIndex);
+			return *this;
+		}
+
+		virtual FArchive& operator<<(FName& /*Name*/) override
+		{
+			Size += sizeof(int32) * 2;
+			return *this;
+		}
+
+		virtual FString GetArchiveName() const override { return TEXT("FObjectOutlinerSerializedSizeCache"); }
+
+		int64 Size = 0;
+	};
+}
+
+TUniquePtr<FObjectOutlinerSerializedSizeCache> FObjectOutlinerSerializedSizeCache::Instance;
+
+FObjectOutlinerSerializedSizeCache& FObjectOutlinerSerializedSizeCache::Get()
+{
+	check(IsInGameThread());
+	if (Instance.IsValid() == false)
+	{
+		Instance = TUniquePtr<FObjectOutlinerSerializedSizeCache>(new FObjectOutlinerSerializedSizeCache());
+	}
+	return *Instance;
+}
+
+void FObjectOutlinerSerializedSizeCache::Shutdown()
+{
+	Instance.Reset();
+}
+
+FObjectOutlinerSerializedSizeCache::FObjectOutlinerSerializedSizeCache()
+{
+	FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FObjectOutlinerSerializedSizeCache::HandleObjectModified);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FObjectOutlinerSerializedSizeCache::HandleObjectPropertyChanged);
+	FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FObjectOutlinerSerializedSizeCache::HandlePostGarbageCollect);
+}
+
+FObjectOutlinerSerializedSizeCache::~FObjectOutlinerSerializedSizeCache()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	FCoreUObjectDelegates::OnObjectModified.RemoveAll(this);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.RemoveAll(this);
+	FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+}
+
+int64 FObjectOutlinerSerializedSizeCache::Find(const UObject* Object) const
+{
+	const int64* Size = Sizes.Find(FObjectKey(Object));
+	return Size != nullptr ? *Size : INDEX_NONE;
+}
+
+void FObjectOutlinerSerializedSizeCache::RequestVisible(const UObject* Object)
+{
+	const FObjectKey Key(Object);
+	if (Object != nullptr && Sizes.Contains(Key) == false && VisibleQueueSet.Contains(Key) == false)
+	{
+		VisibleQueue.Add(Key);
+		VisibleQueueSet.Add(Key);
+		UpdateTicker();
+	}
+}
+
+void FObjectOutlinerSerializedSizeCache::RequestBackground(TArray<TWeakObjectPtr<UObject>>&& Objects)
+{
+	BackgroundQueue = MoveTemp(Objects);
+	BackgroundQueueHead = 0;
+	UpdateTicker();
+}
+
+int64 FObjectOutlinerSerializedSizeCache::Measure(UObject* Object)
+{
+	SerializedSize::FCountingArchive Ar;
+	Object->Serialize(Ar);
+	return Ar.Size;
+}
+
+void FObjectOutlinerSerializedSizeCache::UpdateTicker()
+{
+	if (GetPendingNum() > 0 && TickerHandle.IsValid() == false)
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FObjectOutlinerSerializedSizeCache::HandleTick));
+	}
+}
+
+bool FObjectOutlinerSerializedSizeCache::HandleTick(float /*DeltaTime*/)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerSerializedSizeCache::HandleTick);
+
+	const double EndTime = FPlatformTime::Seconds() + UHazardToolsObjectOutlinerSettings::Get().SerializedSizeBudgetMs / 1000.0;
+
+	// Visible rows first, oldest request first
+	int32 VisibleHead = 0;
+	for (; VisibleHead < VisibleQueue.Num() && FPlatformTime::Seconds() < EndTime; ++VisibleHead)
+	{
+		const FObjectKey Key = VisibleQueue[VisibleHead];
+		VisibleQueueSet.Remove(Key);
+		if (UObject* Object = Key.ResolveObjectPtr())
+		{
+			Sizes.Add(Key, Measure(Object));
+		}
+	}
+	VisibleQueue.RemoveAt(0, VisibleHead, EAllowShrinking::No);
+
+	for (; BackgroundQueueHead < BackgroundQueue.Num() && FPlatformTime::Seconds() < EndTime; ++BackgroundQueueHead)
+	{
+		if (UObject* Object = BackgroundQueue[BackgroundQueueHead].Get())
+		{
+			const FObjectKey Key(Object);
+			if (Sizes.Contains(Key) == false)
+			{
+				Sizes.Add(Key, Measure(Object));
+			}
+		}
+	}
+
+	if (BackgroundQueueHead >= BackgroundQueue.Num())
+	{
+		BackgroundQueue.Empty();
+		BackgroundQueueHead = 0;
+	}
+
+	if (GetPendingNum() == 0)
+	{
+		TickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void FObjectOutlinerSerializedSizeCache::HandleObjectModified(UObject* Object)
+{
+	Sizes.Remove(FObjectKey(Object));
+}
+
+void FObjectOutlinerSerializedSizeCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& /*Event*/)
+{
+	Sizes.Remove(FObjectKey(Object));
+}
+
+void FObjectOutlinerSerializedSizeCache::HandlePostGarbageCollect()
+{
+	// Keys of collected objects never resolve again, drop them to keep the map bounded
+	for (auto It = Sizes.CreateIterator(); It; ++It)
+	{
+		if (It.Key().ResolveObjectPtr() == nullptr)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+}
@@ -0,0 +1,59 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+
+struct FPropertyChangedEvent;
+
+namespace HazardTools
+{
+/**
+ * In-memory serialized size of objects measured with a byte counting saving archive, cached per object until it is modified.
+ * Archive is neither persistent nor cooking, so the number tracks duplication/undo payload rather than package or cooked size.
+ * Measurement runs on game thread in time sliced batches: rows on screen are measured first, then the rest of the requested set.
+ */
+class FObjectOutlinerSerializedSizeCache
+{
+public:
+	static FObjectOutlinerSerializedSizeCache& Get();
+	static void Shutdown();
+
+	~FObjectOutlinerSerializedSizeCache();
+
+	// Cached size or INDEX_NONE if not measured yet, never measures synchronously
+	[[nodiscard]] int64 Find(const UObject* Object) const;
+
+	// Measure object before anything requested with RequestBackground
+	void RequestVisible(const UObject* Object);
+	// Replace background queue with Objects, already measured ones are skipped
+	void RequestBackground(TArray<TWeakObjectPtr<UObject>>&& Objects);
+
+	[[nodiscard]] int32 GetPendingNum() const { return VisibleQueue.Num() + BackgroundQueue.Num() - BackgroundQueueHead; }
+
+	// Exact amount of bytes Object writes into a non persistent saving archive (like FObjectWriter), references count as package indices
+	static int64 Measure(UObject* Object);
+
+private:
+	FObjectOutlinerSerializedSizeCache();
+
+	bool HandleTick(float DeltaTime);
+	void UpdateTicker();
+	void HandleObjectModified(UObject* Object);
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	void HandlePostGarbageCollect();
+
+	static TUniquePtr<FObjectOutlinerSerializedSizeCache> Instance;
+
+	TMap<FObjectKey, int64> Sizes;
+
+	TArray<FObjectKey> VisibleQueue;
+	TSet<FObjectKey> VisibleQueueSet;
+	TArray<TWeakObjectPtr<UObject>> BackgroundQueue;
+	int32 BackgroundQueueHead = 0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
+}
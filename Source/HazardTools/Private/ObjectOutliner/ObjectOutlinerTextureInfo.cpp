@@ -0,0 +1,61 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerTextureInfo.h"
+
+#include "Engine/Texture.h"
+#include "Engine/TextureDefines.h"
+
+namespace HazardTools
+{
+FObjectOutlinerTextureInfo FObjectOutlinerTextureInfo::Make(const UTexture* Texture)
+{
+	check(Texture != nullptr);
+
+	FObjectOutlinerTextureInfo Info;
+
+	// Sizes are computed from platform data mips and cached streaming state, not from RHI resource
+	Info.FullSize = Texture->CalcTextureMemorySizeEnum(TMC_AllMips);
+	Info.ResidentSize = Texture->CalcTextureMemorySizeEnum(TMC_ResidentMips);
+
+	const FStreamableRenderResourceState& StreamingState = Texture->GetStreamableResourceState();
+	if (StreamingState.IsValid())
+	{
+		Info.ResidentMips = StreamingState.NumResidentLODs;
+		Info.TotalMips = StreamingState.MaxNumLODs;
+		Info.bStreamable = StreamingState.bSupportsStreaming;
+	}
+
+	Info.bNeverStream = Texture->NeverStream;
+	Info.LODGroup = FText::FromString(UTexture::GetTextureGroupString(Texture->LODGroup));
+	Info.Compression = StaticEnum<TextureCompressionSettings>()->GetDisplayNameTextByValue(Texture->CompressionSettings);
+
+#if WITH_EDITORONLY_DATA
+	Info.SourceSize = FIntPoint(Texture->Source.GetSizeX(), Texture->Source.GetSizeY());
+#endif
+
+	return Info;
+}
+
+FText FObjectOutlinerTextureInfo::GetMipsText() const
+{
+	return FText::Format(INVTEXT("{0} / {1}"), FText::AsNumber(ResidentMips), FText::AsNumber(TotalMips));
+}
+
+FText FObjectOutlinerTextureInfo::GetSourceSizeText() const
+{
+	if (SourceSize == FIntPoint::ZeroValue)
+	{
+		return INVTEXT("-");
+	}
+	return FText::Format(INVTEXT("{0}x{1}"), FText::AsNumber(SourceSize.X, &FNumberFormattingOptions::DefaultNoGrouping()), FText::AsNumber(SourceSize.Y, &FNumberFormattingOptions::DefaultNoGrouping()));
+}
+
+FText FObjectOutlinerTextureInfo::GetStreamingText() const
+{
+	if (bNeverStream)
+	{
+		return INVTEXT("Never Stream");
+	}
+	return bStreamable ? INVTEXT("Streamable") : INVTEXT("Not Streamed");
+}
+}
@@ -0,0 +1,33 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UTexture;
+
+namespace HazardTools
+{
+/**
+ * Texture memory facts shown in outliner texture columns.
+ * Everything comes from CPU side state (platform data, cached streaming state, source info), so it works with -nullrhi.
+ */
+struct FObjectOutlinerTextureInfo
+{
+	int64 ResidentSize = 0;
+	int64 FullSize = 0;
+	int32 ResidentMips = 0;
+	int32 TotalMips = 0;
+	FIntPoint SourceSize = FIntPoint::ZeroValue;
+	bool bStreamable = false;
+	bool bNeverStream = false;
+	FText LODGroup;
+	FText Compression;
+
+	static FObjectOutlinerTextureInfo Make(const UTexture* Texture);
+
+	[[nodiscard]] FText GetMipsText() const;
+	[[nodiscard]] FText GetSourceSizeText() const;
+	[[nodiscard]] FText GetStreamingText() const;
+};
+}
@@ -0,0 +1,205 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerTickSampler.h"
+
+#include "HazardToolsObjectOutlinerSettings.h"
+#include "Components/ActorComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/UObjectHash.h"
+
+namespace HazardTools
+{
+namespace TickSampler
+{
+// Sampling stops when no report was generated for this long
+constexpr double IdleStopSeconds = 30.0;
+
+// Tick function members of the class, primary tick first as it is declared in a base class
+static const TArray<const FStructProperty*>& GetTickFunctionProperties(const UClass* Class, TMap<const UClass*, TArray<const FStructProperty*>>& Cache)
+{
+	if (const TArray<const FStructProperty*>* Properties = Cache.Find(Class))
+	{
+		return *Properties;
+	}
+
+	TArray<const FStructProperty*>& Properties = Cache.Add(Class);
+	for (TFieldIterator<FStructProperty> It(Class); It; ++It)
+	{
+		if (It->Struct->IsChildOf(FTickFunction::StaticStruct()) && It->GetArrayDim() == 1)
+		{
+			Properties.Add(*It);
+		}
+	}
+	return Properties;
+}
+}
+
+TUniquePtr<FObjectOutlinerTickSampler> FObjectOutlinerTickSampler::Instance;
+
+FObjectOutlinerTickSampler& FObjectOutlinerTickSampler::Get()
+{
+	check(IsInGameThread());
+	if (Instance.IsValid() == false)
+	{
+		Instance = TUniquePtr<FObjectOutlinerTickSampler>(new FObjectOutlinerTickSampler());
+	}
+	return *Instance;
+}
+
+void FObjectOutlinerTickSampler::Shutdown()
+{
+	Instance.Reset();
+}
+
+FObjectOutlinerTickSampler::~FObjectOutlinerTickSampler()
+{
+	Stop();
+}
+
+void FObjectOutlinerTickSampler::GetTickFunctions(UWorld* World, TArray<FTickFunctionInfo>& OutTickFunctions)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerTickSampler::GetTickFunctions);
+
+	TMap<const UClass*, TArray<const FStructProperty*>> PropertiesCache;
+	const auto AddTickFunctions = [&PropertiesCache, &OutTickFunctions](UObject* Owner)
+	{
+		for (const FStructProperty* Property : TickSampler::GetTickFunctionProperties(Owner->GetClass(), PropertiesCache))
+		{
+			FTickFunction* Function = Property->ContainerPtrToValuePtr<FTickFunction>(Owner);
+			if (Function->IsTickFunctionRegistered())
+			{
+				OutTickFunctions.Add({Owner, Property->GetFName(), Function});
+			}
+		}
+	};
+
+	for (const ULevel* Level : World->GetLevels())
+	{
+		if (Level == nullptr)
+		{
+			continue;
+		}
+		for (AActor* Actor : Level->Actors)
+		{
+			if (Actor == nullptr)
+			{
+				continue;
+			}
+			AddTickFunctions(Actor);
+			for (UActorComponent* Component : Actor->GetComponents())
+			{
+				if (Component)
+				{
+					AddTickFunctions(Component);
+				}
+			}
+		}
+	}
+
+	// Other tickable objects are not reachable, engine keeps them in a private list
+	ForEachObjectWithOuter(World, [&OutTickFunctions](UObject* Object)
+	{
+		if (Object->IsA<UTickableWorldSubsystem>())
+		{
+			OutTickFunctions.Add({Object, NAME_None, nullptr});
+		}
+	}, false);
+}
+
+bool FObjectOutlinerTickSampler::IsTickEnabled(const FTickFunctionInfo& TickFunction)
+{
+	if (TickFunction.Function != nullptr)
+	{
+		return TickFunction.Function->IsTickFunctionRegistered() && TickFunction.Function->IsTickFunctionEnabled();
+	}
+	if (const UTickableWorldSubsystem* Subsystem = Cast<UTickableWorldSubsystem>(TickFunction.Owner))
+	{
+		const FTickableGameObject* Tickable = Subsystem;
+		return Tickable->IsTickable();
+	}
+	return false;
+}
+
+void FObjectOutlinerTickSampler::Track(const TArray<FTickFunctionInfo>& TickFunctions)
+{
+	check(IsInGameThread());
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerTickSampler::Track);
+
+	for (const FTickFunctionInfo& TickFunction : TickFunctions)
+	{
+		const FTickKey Key(FObjectKey(TickFunction.Owner), TickFunction.Name);
+		if (Tracked.Contains(Key) == false)
+		{
+			Tracked.Add(Key, {TickFunction.Owner, TickFunction.Function});
+		}
+	}
+
+	LastRequestTime = FPlatformTime::Seconds();
+	Start();
+}
+
+void FObjectOutlinerTickSampler::Start()
+{
+	if (TickerHandle.IsValid() == false)
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FObjectOutlinerTickSampler::HandleTick));
+	}
+}
+
+void FObjectOutlinerTickSampler::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	// Next request starts a fresh window, results of the last complete one stay available
+	Tracked.Reset();
+	CurrentCounts.Reset();
+	CurrentFrames = 0;
+}
+
+bool FObjectOutlinerTickSampler::HandleTick(float /*DeltaTime*/)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerTickSampler::HandleTick);
+
+	if (FPlatformTime::Seconds() - LastRequestTime > TickSampler::IdleStopSeconds)
+	{
+		Stop();
+		return false;
+	}
+
+	for (auto It = Tracked.CreateIterator(); It; ++It)
+	{
+		UObject* Owner = It.Value().Owner.Get();
+		if (Owner == nullptr)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		FCounts& Counts = CurrentCounts.FindOrAdd(It.Key());
+		Counts.SampledFrames++;
+		Counts.EnabledFrames += IsTickEnabled({Owner, It.Key().Value, It.Value().Function}) ? 1 : 0;
+	}
+
+	CurrentFrames++;
+	if (CurrentFrames >= FMath::Max(1, UHazardToolsObjectOutlinerSettings::Get().TickSampleFrames))
+	{
+		CompleteCounts = MoveTemp(CurrentCounts);
+		CurrentCounts.Reset();
+		CurrentFrames = 0;
+		bHasCompleteWindow = true;
+	}
+	return true; // Keep ticking
+}
+
+FObjectOutlinerTickSampler::FCounts FObjectOutlinerTickSampler::GetCounts(const FTickFunctionInfo& TickFunction) const
+{
+	return (bHasCompleteWindow ? CompleteCounts : CurrentCounts).FindRef(FTickKey(FObjectKey(TickFunction.Owner), TickFunction.Name));
+}
+}
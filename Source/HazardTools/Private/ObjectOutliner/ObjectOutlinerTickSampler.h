@@ -0,0 +1,83 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Engine/EngineBaseTypes.h"
+#include "UObject/ObjectKey.h"
+
+namespace HazardTools
+{
+/**
+ * Samples every frame whether tracked tick functions and tickable world subsystems are enabled.
+ * Counters cover a window of TickSampleFrames frames, the last complete window is kept while the next one is collected.
+ * Tick functions are only read, registration, prerequisites and tick order are left to engine.
+ * Sampling stops on its own when no report asked for it for a while.
+ */
+class FObjectOutlinerTickSampler
+{
+public:
+	static FObjectOutlinerTickSampler& Get();
+	static void Shutdown();
+
+	~FObjectOutlinerTickSampler();
+
+	// Tick function property of an actor or component, or tickable world subsystem when Function is null
+	struct FTickFunctionInfo
+	{
+		UObject* Owner = nullptr;
+		// Tick function property name, none for subsystems
+		FName Name;
+		FTickFunction* Function = nullptr;
+	};
+
+	struct FCounts
+	{
+		int32 EnabledFrames = 0;
+		int32 SampledFrames = 0;
+	};
+
+	// Registered tick functions of all actors and components in the world, and tickable world subsystems
+	static void GetTickFunctions(UWorld* World, TArray<FTickFunctionInfo>& OutTickFunctions);
+
+	// Start sampling tick functions which are not tracked yet
+	void Track(const TArray<FTickFunctionInfo>& TickFunctions);
+
+	// Last complete window if there is one, otherwise current partial window
+	[[nodiscard]] FCounts GetCounts(const FTickFunctionInfo& TickFunction) const;
+	[[nodiscard]] int32 GetCurrentWindowFrames() const { return CurrentFrames; }
+	[[nodiscard]] bool HasCompleteWindow() const { return bHasCompleteWindow; }
+
+	// Registered and enabled tick function, or tickable world subsystem which is tickable right now
+	static bool IsTickEnabled(const FTickFunctionInfo& TickFunction);
+
+private:
+	struct FTracked
+	{
+		TWeakObjectPtr<UObject> Owner;
+		// Member of owner, only read while owner is valid
+		FTickFunction* Function = nullptr;
+	};
+
+	using FTickKey = TPair<FObjectKey, FName>;
+
+	FObjectOutlinerTickSampler() = default;
+
+	void Start();
+	void Stop();
+	bool HandleTick(float DeltaTime);
+
+	static TUniquePtr<FObjectOutlinerTickSampler> Instance;
+
+	TMap<FTickKey, FTracked> Tracked;
+
+	TMap<FTickKey, FCounts> CurrentCounts;
+	TMap<FTickKey, FCounts> CompleteCounts;
+	int32 CurrentFrames = 0;
+	bool bHasCompleteWindow = false;
+
+	double LastRequestTime = 0.0;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
+}
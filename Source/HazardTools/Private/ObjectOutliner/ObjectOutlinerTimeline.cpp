@@ -0,0 +1,185 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerTimeline.h"
+
+#include "Editor.h"
+#include "HazardToolsObjectOutlinerSettings.h"
+#include "ObjectOutlinerExport.h"
+#include "ObjectOutlinerPopulationTracker.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+
+namespace HazardTools
+{
+TUniquePtr<FObjectOutlinerTimeline> FObjectOutlinerTimeline::Instance;
+
+void FObjectOutlinerTimeline::Startup()
+{
+	check(IsInGameThread());
+	if (Instance.IsValid() == false && FObjectOutlinerPopulationTracker::Get() != nullptr)
+	{
+		Instance = TUniquePtr<FObjectOutlinerTimeline>(new FObjectOutlinerTimeline());
+	}
+}
+
+void FObjectOutlinerTimeline::Shutdown()
+{
+	Instance.Reset();
+}
+
+FObjectOutlinerTimeline::FObjectOutlinerTimeline()
+{
+	const UHazardToolsObjectOutlinerSettings& Settings = UHazardToolsObjectOutlinerSettings::Get();
+
+	Samples.SetCapacity(Settings.TimelineCapacity);
+	Markers.SetCapacity(128);
+	TopClassesNum = FMath::Max(0, Settings.TimelineTopClassesNum);
+	StartTime = FPlatformTime::Seconds();
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FObjectOutlinerTimeline::HandleTick),
+		FMath::Max(0.1f, Settings.TimelineSampleInterval));
+
+	FEditorDelegates::OnMapOpened.AddRaw(this, &FObjectOutlinerTimeline::HandleMapOpened);
+	FEditorDelegates::BeginPIE.AddRaw(this, &FObjectOutlinerTimeline::HandleBeginPIE);
+	FEditorDelegates::EndPIE.AddRaw(this, &FObjectOutlinerTimeline::HandleEndPIE);
+
+	// Asset editor subsystem does not exist yet when module starts with the editor
+	if (GEditor != nullptr)
+	{
+		HandlePostEngineInit();
+	}
+	else
+	{
+		FCoreDelegates::OnPostEngineInit.AddRaw(this, &FObjectOutlinerTimeline::HandlePostEngineInit);
+	}
+
+	TakeSample();
+}
+
+FObjectOutlinerTimeline::~FObjectOutlinerTimeline()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+	FCoreDelegates::OnPostEngineInit.RemoveAll(this);
+	FEditorDelegates::OnMapOpened.RemoveAll(this);
+	FEditorDelegates::BeginPIE.RemoveAll(this);
+	FEditorDelegates::EndPIE.RemoveAll(this);
+
+	if (GEditor != nullptr)
+	{
+		if (UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
+		{
+			AssetEditorSubsystem->OnAssetEditorOpened().RemoveAll(this);
+		}
+	}
+}
+
+void FObjectOutlinerTimeline::AddMarker(const FString& Label)
+{
+	FObjectOutlinerTimelineMarker Marker;
+	Marker.Time = FPlatformTime::Seconds() - StartTime;
+	Marker.Label = Label;
+	Markers.Add(MoveTemp(Marker));
+}
+
+bool FObjectOutlinerTimeline::HandleTick(float /*DeltaTime*/)
+{
+	TakeSample();
+	return true; // Keep ticking
+}
+
+void FObjectOutlinerTimeline::TakeSample()
+{
+	const FObjectOutlinerPopulationTracker* Tracker = FObjectOutlinerPopulationTracker::Get();
+	if (Tracker == nullptr)
+	{
+		return;
+	}
+
+	TArray<TPair<FName, int32>> TopClasses;
+	Tracker->GetTopClasses(TopClassesNum, TopClasses);
+
+	FObjectOutlinerTimelineSample Sample;
+	Sample.Time = FPlatformTime::Seconds() - StartTime;
+	Sample.TotalNum = Tracker->GetTotalNum();
+	Sample.TopClasses.Append(TopClasses);
+
+	Samples.Add(MoveTemp(Sample));
+}
+
+void FObjectOutlinerTimeline::HandlePostEngineInit()
+{
+	if (GEditor != nullptr)
+	{
+		if (UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
+		{
+			AssetEditorSubsystem->OnAssetEditorOpened().AddRaw(this, &FObjectOutlinerTimeline::HandleAssetEditorOpened);
+		}
+	}
+}
+
+void FObjectOutlinerTimeline::HandleMapOpened(const FString& Filename, bool /*bAsTemplate*/)
+{
+	AddMarker(FString::Printf(TEXT("Map: %s"), *FPaths::GetBaseFilename(Filename)));
+}
+
+void FObjectOutlinerTimeline::HandleBeginPIE(const bool bIsSimulating)
+{
+	AddMarker(bIsSimulating ? TEXT("SIE Begin") : TEXT("PIE Begin"));
+}
+
+void FObjectOutlinerTimeline::HandleEndPIE(const bool bIsSimulating)
+{
+	AddMarker(bIsSimulating ? TEXT("SIE End") : TEXT("PIE End"));
+}
+
+void FObjectOutlinerTimeline::HandleAssetEditorOpened(UObject* Asset)
+{
+	if (Asset != nullptr)
+	{
+		AddMarker(FString::Printf(TEXT("Editor: %s"), *Asset->GetName()));
+	}
+}
+
+FString FObjectOutlinerTimeline::GetDefaultSaveFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("HazardTools") / FString::Printf(TEXT("ObjectCountTimeline-%s.csv"), *FDateTime::Now().ToString());
+}
+
+bool FObjectOutlinerTimeline::SaveToFile(const FString& Filename) const
+{
+	FObjectOutlinerTextFileWriter Writer(Filename);
+	if (Writer.IsOpen() == false)
+	{
+		return false;
+	}
+
+	// Long format: one row per (time, series) pair, markers use Count column as empty
+	FStringBuilderBase& Builder = Writer.GetBuilder();
+	Builder.Append(TEXT("Time,Series,Count\n"));
+
+	for (int32 i = 0; i < Samples.Num(); ++i)
+	{
+		const FObjectOutlinerTimelineSample& Sample = Samples[i];
+		Builder.Appendf(TEXT("%.2f,Total,%d\n"), Sample.Time, Sample.TotalNum);
+		for (const TPair<FName, int32>& Pair : Sample.TopClasses)
+		{
+			Builder.Appendf(TEXT("%.2f,"), Sample.Time);
+			FObjectOutlinerTextFileWriter::AppendCsvField(Builder, Pair.Key.ToString());
+			Builder.Appendf(TEXT(",%d\n"), Pair.Value);
+		}
+		Writer.MaybeFlush();
+	}
+
+	for (int32 i = 0; i < Markers.Num(); ++i)
+	{
+		Builder.Appendf(TEXT("%.2f,"), Markers[i].Time);
+		FObjectOutlinerTextFileWriter::AppendCsvField(Builder, FString::Printf(TEXT("Marker: %s"), *Markers[i].Label));
+		Builder.Append(TEXT(",\n"));
+		Writer.MaybeFlush();
+	}
+
+	Writer.Close();
+	return true;
+}
+}
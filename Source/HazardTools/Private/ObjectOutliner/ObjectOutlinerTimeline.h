@@ -0,0 +1,135 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+namespace HazardTools
+{
+/** Fixed capacity ring buffer, oldest element is overwritten when full. Index 0 is the oldest element. */
+template <typename ElementType>
+class TObjectOutlinerRingBuffer
+{
+public:
+	explicit TObjectOutlinerRingBuffer(const int32 InCapacity = 1)
+	{
+		SetCapacity(InCapacity);
+	}
+
+	void SetCapacity(const int32 InCapacity)
+	{
+		Capacity = FMath::Max(1, InCapacity);
+		Reset();
+		Elements.Reserve(Capacity);
+	}
+
+	void Add(ElementType&& Element)
+	{
+		if (Elements.Num() < Capacity)
+		{
+			Elements.Add(MoveTemp(Element));
+		}
+		else
+		{
+			Elements[Head] = MoveTemp(Element);
+			Head = (Head + 1) % Capacity;
+		}
+	}
+
+	void Reset()
+	{
+		Elements.Reset();
+		Head = 0;
+	}
+
+	[[nodiscard]] int32 Num() const { return Elements.Num(); }
+	[[nodiscard]] int32 GetCapacity() const { return Capacity; }
+
+	const ElementType& operator[](const int32 Index) const
+	{
+		return Elements[(Head + Index) % Elements.Num()];
+	}
+
+	const ElementType& Last() const
+	{
+		return (*this)[Num() - 1];
+	}
+
+private:
+	TArray<ElementType> Elements;
+	int32 Capacity = 1;
+	int32 Head = 0;
+};
+
+struct FObjectOutlinerTimelineSample
+{
+	// Seconds since timeline start
+	double Time = 0.0;
+	int32 TotalNum = 0;
+	TArray<TPair<FName, int32>, TInlineAllocator<8>> TopClasses;
+
+	int32 FindClassNum(const FName ClassName) const
+	{
+		for (const TPair<FName, int32>& Pair : TopClasses)
+		{
+			if (Pair.Key == ClassName)
+			{
+				return Pair.Value;
+			}
+		}
+		return INDEX_NONE;
+	}
+};
+
+struct FObjectOutlinerTimelineMarker
+{
+	double Time = 0.0;
+	FString Label;
+};
+
+/**
+ * Periodically samples object counters maintained by FObjectOutlinerPopulationTracker into a ring buffer.
+ * Map loads, PIE sessions and opened asset editors are recorded as markers to correlate with object count changes.
+ */
+class FObjectOutlinerTimeline
+{
+public:
+	static void Startup();
+	static void Shutdown();
+
+	static FObjectOutlinerTimeline* Get() { return Instance.Get(); }
+
+	~FObjectOutlinerTimeline();
+
+	const TObjectOutlinerRingBuffer<FObjectOutlinerTimelineSample>& GetSamples() const { return Samples; }
+	const TObjectOutlinerRingBuffer<FObjectOutlinerTimelineMarker>& GetMarkers() const { return Markers; }
+
+	void AddMarker(const FString& Label);
+
+	// Write samples and markers as CSV, returns false if file can't be opened
+	bool SaveToFile(const FString& Filename) const;
+	static FString GetDefaultSaveFilename();
+
+private:
+	FObjectOutlinerTimeline();
+
+	bool HandleTick(float DeltaTime);
+	void TakeSample();
+
+	void HandlePostEngineInit();
+	void HandleMapOpened(const FString& Filename, bool bAsTemplate);
+	void HandleBeginPIE(bool bIsSimulating);
+	void HandleEndPIE(bool bIsSimulating);
+	void HandleAssetEditorOpened(UObject* Asset);
+
+	static TUniquePtr<FObjectOutlinerTimeline> Instance;
+
+	TObjectOutlinerRingBuffer<FObjectOutlinerTimelineSample> Samples;
+	TObjectOutlinerRingBuffer<FObjectOutlinerTimelineMarker> Markers;
+
+	double StartTime = 0.0;
+	int32 TopClassesNum = 5;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
+}
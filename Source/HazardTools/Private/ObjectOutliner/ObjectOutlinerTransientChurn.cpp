@@ -0,0 +1,161 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerTransientChurn.h"
+
+#include "HazardTools.h"
+#include "HazardToolsObjectOutlinerSettings.h"
+#include "ObjectOutlinerReport.h"
+
+namespace HazardTools
+{
+TUniquePtr<FObjectOutlinerTransientChurn> FObjectOutlinerTransientChurn::Instance;
+
+void FObjectOutlinerTransientChurn::Startup()
+{
+	check(IsInGameThread());
+	if (Instance.IsValid() == false && FObjectOutlinerPopulationTracker::Get() != nullptr)
+	{
+		Instance = TUniquePtr<FObjectOutlinerTransientChurn>(new FObjectOutlinerTransientChurn());
+	}
+}
+
+void FObjectOutlinerTransientChurn::Shutdown()
+{
+	Instance.Reset();
+}
+
+FObjectOutlinerTransientChurn::FObjectOutlinerTransientChurn()
+{
+	const UHazardToolsObjectOutlinerSettings& Settings = UHazardToolsObjectOutlinerSettings::Get();
+	SampleInterval = FMath::Max(0.1f, Settings.TimelineSampleInterval);
+	Samples.SetCapacity(FMath::CeilToInt32(FMath::Max(1, Settings.TransientChurnWindowMinutes) * 60.0 / SampleInterval));
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FObjectOutlinerTransientChurn::HandleTick), SampleInterval);
+}
+
+FObjectOutlinerTransientChurn::~FObjectOutlinerTransientChurn()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+}
+
+bool FObjectOutlinerTransientChurn::HandleTick(float /*DeltaTime*/)
+{
+	TakeSample(false);
+	return true; // Keep ticking
+}
+
+void FObjectOutlinerTransientChurn::TakeSample(const bool bFindRenames)
+{
+	FObjectOutlinerPopulationTracker* Tracker = FObjectOutlinerPopulationTracker::Get();
+	if (Tracker == nullptr)
+	{
+		return;
+	}
+
+	FCountsMap Sample;
+	Tracker->ConsumeTransientCounts(Sample);
+	if (bFindRenames)
+	{
+		Tracker->FindTransientRenames(Sample);
+	}
+
+	for (TPair<const UObjectBase*, FCounts>& Pair : Sample)
+	{
+		FClassChurn& ClassChurn = Classes.FindOrAdd(Pair.Key);
+		if (Pair.Value.ClassName.IsNone() == false)
+		{
+			ClassChurn.ClassName = Pair.Value.ClassName;
+		}
+		Pair.Value.ClassName = ClassChurn.ClassName;
+		ClassChurn.CreatedTotal += Pair.Value.CreatedNum;
+		ClassChurn.DeletedTotal += Pair.Value.DeletedNum;
+		ClassChurn.LiveNum += Pair.Value.SeededNum + Pair.Value.GetEnteredNum() - Pair.Value.GetLeftNum();
+	}
+
+	Samples.Add(MoveTemp(Sample));
+}
+
+TSharedRef<FObjectOutlinerReport> FObjectOutlinerTransientChurn::MakeReport()
+{
+	check(IsInGameThread());
+
+	TakeSample(true);
+
+	TMap<const UObjectBase*, FCounts> Window;
+	for (int32 SampleIndex = 0; SampleIndex < Samples.Num(); ++SampleIndex)
+	{
+		for (const TPair<const UObjectBase*, FCounts>& Pair : Samples[SampleIndex])
+		{
+			FCounts& Counts = Window.FindOrAdd(Pair.Key);
+			Counts.CreatedNum += Pair.Value.CreatedNum;
+			Counts.DeletedNum += Pair.Value.DeletedNum;
+			Counts.RenamedInNum += Pair.Value.RenamedInNum;
+			Counts.RenamedOutNum += Pair.Value.RenamedOutNum;
+		}
+	}
+
+	struct FRowData
+	{
+		const FClassChurn* Churn = nullptr;
+		FCounts Window;
+		bool bAccumulating = false;
+	};
+	TArray<FRowData> RowsData;
+	for (const TPair<const UObjectBase*, FClassChurn>& Pair : Classes)
+	{
+		if (Pair.Value.LiveNum == 0 && Window.Contains(Pair.Key) == false)
+		{
+			continue;
+		}
+
+		FRowData& RowData = RowsData.AddDefaulted_GetRef();
+		RowData.Churn = &Pair.Value;
+		RowData.Window = Window.FindRef(Pair.Key);
+		// Entered inside the window and none was collected or moved out
+		RowData.bAccumulating = RowData.Window.GetEnteredNum() > 0 && RowData.Window.GetLeftNum() == 0;
+	}
+
+	RowsData.Sort([](const FRowData& A, const FRowData& B)
+	{
+		const int32 NetA = A.Window.GetEnteredNum() - A.Window.GetLeftNum();
+		const int32 NetB = B.Window.GetEnteredNum() - B.Window.GetLeftNum();
+		return NetA != NetB ? NetA > NetB : A.Churn->LiveNum > B.Churn->LiveNum;
+	});
+
+	const double WindowSeconds = Samples.Num() * SampleInterval;
+	const TSharedRef<FObjectOutlinerReport> Report = MakeShared<FObjectOutlinerReport>(INVTEXT("Transient Package Churn"));
+	const int32 Column_Name = Report->AddColumn("Class", INVTEXT("Class"), EObjectOutlinerReportColumnType::Text, 0.3f);
+	const int32 Column_Live = Report->AddColumn("Live", INVTEXT("Live"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_Net = Report->AddColumn("Net", INVTEXT("Net (Window)"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_Created = Report->AddColumn("Created", INVTEXT("Created (Window)"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_Deleted = Report->AddColumn("Deleted", INVTEXT("Destroyed (Window)"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_RenamedIn = Report->AddColumn("RenamedIn", INVTEXT("Renamed In (Window)"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_RenamedOut = Report->AddColumn("RenamedOut", INVTEXT("Renamed Out (Window)"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_CreatedTotal = Report->AddColumn("CreatedTotal", INVTEXT("Created (Total)"), EObjectOutlinerReportColumnType::Number, 0.1f);
+	const int32 Column_DeletedTotal = Report->AddColumn("DeletedTotal", INVTEXT("Destroyed (Total)"), EObjectOutlinerReportColumnType::Number, 0.1f);
+
+	int32 AccumulatingNum = 0;
+	for (const FRowData& RowData : RowsData)
+	{
+		FObjectOutlinerReportRow& Row = Report->AddRow();
+		Row.SetText(Column_Name, RowData.Churn->ClassName.ToString());
+		Row.SetValue(Column_Live, RowData.Churn->LiveNum);
+		Row.SetValue(Column_Net, RowData.Window.GetEnteredNum() - RowData.Window.GetLeftNum());
+		Row.SetValue(Column_Created, RowData.Window.CreatedNum);
+		Row.SetValue(Column_Deleted, RowData.Window.DeletedNum);
+		Row.SetValue(Column_RenamedIn, RowData.Window.RenamedInNum);
+		Row.SetValue(Column_RenamedOut, RowData.Window.RenamedOutNum);
+		Row.SetValue(Column_CreatedTotal, RowData.Churn->CreatedTotal);
+		Row.SetValue(Column_DeletedTotal, RowData.Churn->DeletedTotal);
+		Row.bHighlight = RowData.bAccumulating;
+		AccumulatingNum += RowData.bAccumulating ? 1 : 0;
+	}
+
+	Report->Summary = FText::Format(
+		INVTEXT("Transient package objects over last {0}. {1} highlighted classes were created or renamed into transient package in this window and none of them was collected or moved out."),
+		FText::AsTimespan(FTimespan::FromSeconds(WindowSeconds)),
+		FText::AsNumber(AccumulatingNum));
+
+	return Report;
+}
+}
@@ -0,0 +1,60 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ObjectOutlinerPopulationTracker.h"
+#include "ObjectOutlinerTimeline.h"
+#include "Containers/Ticker.h"
+
+namespace HazardTools
+{
+class FObjectOutlinerReport;
+
+/**
+ * Counts objects created and destroyed inside transient package per class over a sliding window,
+ * to find classes which keep accumulating there without ever being collected.
+ *
+ * Membership and counters are kept by population tracker listeners, this only drains them into samples on game thread.
+ * Renames into or out of transient package (deleted assets, objects created there and moved to a package) walk
+ * the whole package, so they are only looked for when report is made and land in its last sample.
+ */
+class FObjectOutlinerTransientChurn
+{
+public:
+	static void Startup();
+	static void Shutdown();
+
+	// Null if tracking is not running (commandlet or disabled in settings)
+	static FObjectOutlinerTransientChurn* Get() { return Instance.Get(); }
+
+	~FObjectOutlinerTransientChurn();
+
+	// Game thread only: live, windowed and total counters per class
+	[[nodiscard]] TSharedRef<FObjectOutlinerReport> MakeReport();
+
+private:
+	using FCounts = FObjectOutlinerPopulationTracker::FTransientCounts;
+	using FCountsMap = FObjectOutlinerPopulationTracker::FTransientCountsMap;
+
+	struct FClassChurn
+	{
+		FName ClassName;
+		int64 LiveNum = 0;
+		int64 CreatedTotal = 0;
+		int64 DeletedTotal = 0;
+	};
+
+	FObjectOutlinerTransientChurn();
+
+	bool HandleTick(float DeltaTime);
+	void TakeSample(bool bFindRenames);
+
+	static TUniquePtr<FObjectOutlinerTransientChurn> Instance;
+
+	TObjectOutlinerRingBuffer<FCountsMap> Samples;
+	TMap<const UObjectBase*, FClassChurn> Classes;
+	double SampleInterval = 5.0;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
+}
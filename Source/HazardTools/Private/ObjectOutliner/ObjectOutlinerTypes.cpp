@@ -6,20 +6,63 @@
 #include "SourceCodeNavigation.h"
 #include "ToolMenu.h"
 #include "HazardTools.h"
-#include "HazardToolsUtils.h"
+#include "ObjectOutlinerBatchActions.h"
+#include "ObjectOutlinerTextureInfo.h"
+#include "ObjectOutlinerWatchList.h"
+#include "Engine/Texture.h"
 
 namespace HazardTools
 {
-void FObjectOutlinerItemActions::GenerateContextMenu(UToolMenu* Menu, const FObjectOutlinerItemPtr Item)
+int64 FObjectOutlinerItem::GetMemory() const
 {
-	check(Item.IsValid());
-	const UObject* Object = Item->ObjectPtr.Get();
+	if (CachedMemory == INDEX_NONE)
+	{
+		UObject* Object = ObjectPtr.Get();
+		CachedMemory = Object != nullptr ? Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive) : 0;
+	}
+	return CachedMemory;
+}
 
-	if (Object == nullptr)
+const FObjectOutlinerTextureInfo* FObjectOutlinerItem::GetTextureInfo() const
+{
+	if (bTextureInfoCached == false)
 	{
-		return;
+		bTextureInfoCached = true;
+		if (const UTexture* Texture = Cast<UTexture>(ObjectPtr.Get()); Texture != nullptr && bIsGroupNode == false)
+		{
+			CachedTextureInfo = MakeShared<FObjectOutlinerTextureInfo>(FObjectOutlinerTextureInfo::Make(Texture));
+		}
+	}
+	return CachedTextureInfo.Get();
+}
+
+void FObjectOutlinerItemActions::GenerateContextMenu(UToolMenu* Menu, const TArray<FObjectOutlinerItemPtr>& Items)
+{
+	// Group nodes stand for their content, batch actions only take objects listed for themselves
+	TArray<TWeakObjectPtr<UObject>> Objects;
+	Objects.Reserve(Items.Num());
+	for (const FObjectOutlinerItemPtr& Item : Items)
+	{
+		if (Item.IsValid() && Item->bIsGroupNode == false && Item->ObjectPtr.IsValid())
+		{
+			Objects.Add(Item->ObjectPtr);
+		}
 	}
 
+	const UObject* Object = Objects.Num() == 1 ? Objects[0].Get() : nullptr;
+	if (Object != nullptr)
+	{
+		GenerateSingleObjectSection(Menu, Object);
+	}
+
+	if (Objects.Num() > 0)
+	{
+		GenerateSelectionSection(Menu, Objects);
+	}
+}
+
+void FObjectOutlinerItemActions::GenerateSingleObjectSection(UToolMenu* Menu, const UObject* Object)
+{
 	FToolMenuSection& Section = Menu->AddSection("ObjectOutlinerContextActions", INVTEXT("Common"));
 
 	Section.AddMenuEntry("OpenSourceFile",
@@ -32,12 +75,52 @@ void FObjectOutlinerItemActions::GenerateContextMenu(UToolMenu* Menu, const FObj
 			)
 		);
 
+}
+
+void FObjectOutlinerItemActions::GenerateSelectionSection(UToolMenu* Menu, const TArray<TWeakObjectPtr<UObject>>& Objects)
+{
+	FToolMenuSection& Section = Menu->AddSection("ObjectOutlinerSelectionActions",
+		Objects.Num() > 1 ? FText::Format(INVTEXT("Selection ({0})"), FText::AsNumber(Objects.Num())) : INVTEXT("Selection"));
+
+	// Every action takes its own copy of the snapshot, menu may be opened again before it completes
 	Section.AddMenuEntry("CopyObjectPath",
-		INVTEXT("Copy Object Path"),
-		FText::GetEmpty(),
-		FSlateIcon(FAppStyle::GetAppStyleSetName(), "SystemWideCommands.FindInContentBrowser"),
+		Objects.Num() > 1 ? INVTEXT("Copy Object Paths") : INVTEXT("Copy Object Path"),
+		INVTEXT("Copy paths of selected objects, one per line"),
+		FSlateIcon(FAppStyle::GetAppStyleSetName(), "GenericCommands.Copy"),
+		FUIAction(FExecuteAction::CreateLambda([Objects]() mutable { FObjectOutlinerBatchActions::CopyPathsAsync(MoveTemp(Objects)); }))
+		);
+
+	Section.AddMenuEntry("ExportSelected",
+		INVTEXT("Export Selected..."),
+		INVTEXT("Export selected objects to CSV or JSON file"),
+		FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Save"),
+		FUIAction(FExecuteAction::CreateLambda([Objects]() mutable { FObjectOutlinerBatchActions::ExportAsync(MoveTemp(Objects)); }))
+		);
+
+	Section.AddMenuEntry("OpenEditors",
+		Objects.Num() > 1 ? INVTEXT("Open Editors") : INVTEXT("Open Editor"),
+		INVTEXT("Open asset editor for selected objects"),
+		FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Edit"),
+		FUIAction(FExecuteAction::CreateLambda([Objects]() mutable { FObjectOutlinerBatchActions::OpenEditors(MoveTemp(Objects)); }))
+		);
+
+	Section.AddMenuEntry("AddToWatchList",
+		INVTEXT("Add to Watch List"),
+		INVTEXT("Track which properties of selected objects change from frame to frame"),
+		FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Visible"),
 		FUIAction(
-			FExecuteAction::CreateStatic(&FObjectOutlinerItemActions::CopyObjectPath, Object)
+			FExecuteAction::CreateLambda([Objects]() mutable { FObjectOutlinerBatchActions::AddToWatchList(MoveTemp(Objects)); }),
+			FCanExecuteAction::CreateLambda([Objects]() { return Objects.Num() > 1 || (Objects[0].IsValid() && FObjectOutlinerWatchList::Get().Contains(Objects[0].Get()) == false); })
+			)
+		);
+
+	Section.AddMenuEntry("MarkAsGarbage",
+		INVTEXT("Mark as Garbage"),
+		INVTEXT("Mark selected objects as garbage, next garbage collection destroys them and clears references to them. Actors and components are destroyed like from level editor. Rooted objects, class defaults, reflection types and assets open in an editor are skipped."),
+		FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Delete"),
+		FUIAction(
+			FExecuteAction::CreateLambda([Objects]() mutable { FObjectOutlinerBatchActions::MarkAsGarbage(MoveTemp(Objects)); }),
+			FCanExecuteAction::CreateLambda([Objects]() { return Objects.Num() > 1 || FObjectOutlinerBatchActions::CanMarkAsGarbage(Objects[0].Get()); })
 			)
 		);
 }
@@ -66,13 +149,4 @@ bool FObjectOutlinerItemActions::CanOpenHeaderFile(const UObject* Object)
 {
 	return true;
 }
-
-void FObjectOutlinerItemActions::CopyObjectPath(const UObject* Object)
-{
-	if (IsValid(Object))
-	{
-		const FString ClipboardText = Object->GetPathName();
-		FHazardToolsUtils::SetClipboardText(ClipboardText);
-	}
-}
 }
@@ -8,7 +8,9 @@ namespace HazardTools
 enum class EDisplayMode : uint8
 {
 	List,
-	Tree
+	Tree,
+	ClassTree, // Grouped by class inheritance chain
+	Packages   // Grouped by outermost package
 };
 
 struct FObjectOutlinerItem : TSharedFromThis<FObjectOutlinerItem>
@@ -32,6 +34,24 @@ struct FObjectOutlinerItem : TSharedFromThis<FObjectOutlinerItem>
 
 	bool bChildrenRequireSort = true;
 
+	// Exclusive resource size, computed on first use so sorting does not query it on every comparison
+	mutable int64 CachedMemory = INDEX_NONE;
+
+	int64 GetMemory() const;
+
+	// Texture columns data, gathered on first use for texture items, null for everything else
+	mutable TSharedPtr<const FObjectOutlinerTextureInfo> CachedTextureInfo;
+	mutable bool bTextureInfoCached = false;
+
+	const FObjectOutlinerTextureInfo* GetTextureInfo() const;
+
+	// Synthetic class node in class tree mode, ObjectPtr is the class itself, children are subclass nodes and instances.
+	// Package node in packages mode, ObjectPtr is the package, children are objects inside it.
+	bool bIsGroupNode = false;
+	// Instances and exclusive memory rolled up through subclasses or package content, valid for group nodes only
+	int32 GroupedNum = 0;
+	int64 GroupedMemory = 0;
+
 	void AddChild(const TSharedRef<FObjectOutlinerItem> Child)
 	{
 		check(!Children.Contains(Child));
@@ -55,12 +75,14 @@ struct FObjectOutlinerItem : TSharedFromThis<FObjectOutlinerItem>
 class FObjectOutlinerItemActions
 {
 public:
-	static void GenerateContextMenu(UToolMenu* Menu, FObjectOutlinerItemPtr Item);
+	// Single object actions when one object is selected, batch actions for any selection
+	static void GenerateContextMenu(UToolMenu* Menu, const TArray<FObjectOutlinerItemPtr>& Items);
 
 private:
+	static void GenerateSingleObjectSection(UToolMenu* Menu, const UObject* Object);
+	static void GenerateSelectionSection(UToolMenu* Menu, const TArray<TWeakObjectPtr<UObject>>& Objects);
+
 	static void OpenHeaderFile(const UObject* Object);
 	static bool CanOpenHeaderFile(const UObject* Object);
-
-	static void CopyObjectPath(const UObject* Object);
 };
 }
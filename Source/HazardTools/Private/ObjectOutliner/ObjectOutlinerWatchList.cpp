@@ -0,0 +1,154 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "ObjectOutlinerWatchList.h"
+
+#include "ObjectOutlinerPropertyHash.h"
+
+namespace HazardTools
+{
+TUniquePtr<FObjectOutlinerWatchList> FObjectOutlinerWatchList::Instance;
+
+FObjectOutlinerWatchList& FObjectOutlinerWatchList::Get()
+{
+	check(IsInGameThread());
+	if (Instance.IsValid() == false)
+	{
+		Instance = TUniquePtr<FObjectOutlinerWatchList>(new FObjectOutlinerWatchList());
+	}
+	return *Instance;
+}
+
+void FObjectOutlinerWatchList::Shutdown()
+{
+	Instance.Reset();
+}
+
+FObjectOutlinerWatchList::~FObjectOutlinerWatchList()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+}
+
+void FObjectOutlinerWatchList::Add(UObject* Object)
+{
+	if (Object == nullptr || Contains(Object))
+	{
+		return;
+	}
+
+	FObjectOutlinerWatchEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Object = Object;
+	Entry.ObjectName = Object->GetName();
+	BuildLayout(Entry, Object);
+
+	Revision++;
+	UpdateTicker();
+}
+
+void FObjectOutlinerWatchList::Remove(const int32 EntryIndex)
+{
+	if (Entries.IsValidIndex(EntryIndex))
+	{
+		Entries.RemoveAt(EntryIndex);
+		Revision++;
+		UpdateTicker();
+	}
+}
+
+void FObjectOutlinerWatchList::Reset()
+{
+	Entries.Reset();
+	Revision++;
+	UpdateTicker();
+}
+
+bool FObjectOutlinerWatchList::Contains(const UObject* Object) const
+{
+	return Entries.ContainsByPredicate([Object](const FObjectOutlinerWatchEntry& Entry) { return Entry.Object.Get() == Object; });
+}
+
+void FObjectOutlinerWatchList::BuildLayout(FObjectOutlinerWatchEntry& Entry, const UObject* Object)
+{
+	Entry.LayoutClass = Object->GetClass();
+	Entry.Properties.Reset();
+
+	for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
+	{
+		if (FObjectOutlinerPropertyHash::IsHashable(*It))
+		{
+			FObjectOutlinerWatchedProperty& WatchedProperty = Entry.Properties.AddDefaulted_GetRef();
+			WatchedProperty.Property = *It;
+			WatchedProperty.PropertyName = It->GetFName();
+			WatchedProperty.Hash = FObjectOutlinerPropertyHash::HashProperty(*It, Object);
+		}
+	}
+}
+
+void FObjectOutlinerWatchList::DropLayout(FObjectOutlinerWatchEntry& Entry)
+{
+	// Counters stay for display, only property pointers are released
+	Entry.LayoutClass.Reset();
+	for (FObjectOutlinerWatchedProperty& WatchedProperty : Entry.Properties)
+	{
+		WatchedProperty.Property = nullptr;
+	}
+}
+
+void FObjectOutlinerWatchList::UpdateTicker()
+{
+	if (Entries.Num() > 0 && TickerHandle.IsValid() == false)
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FObjectOutlinerWatchList::HandleTick));
+	}
+	else if (Entries.Num() == 0 && TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+bool FObjectOutlinerWatchList::HandleTick(float /*DeltaTime*/)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FObjectOutlinerWatchList::HandleTick);
+
+	for (FObjectOutlinerWatchEntry& Entry : Entries)
+	{
+		const UObject* Object = Entry.Object.Get();
+		if (Object == nullptr)
+		{
+			if (Entry.LayoutClass.IsExplicitlyNull() == false)
+			{
+				DropLayout(Entry);
+			}
+			continue;
+		}
+
+		// Blueprint recompile or reinstancing, old FProperty pointers must not be used
+		if (Entry.LayoutClass.Get() != Object->GetClass())
+		{
+			BuildLayout(Entry, Object);
+			Revision++;
+			continue;
+		}
+
+		bool bAnyChanged = false;
+		for (FObjectOutlinerWatchedProperty& WatchedProperty : Entry.Properties)
+		{
+			const uint32 Hash = FObjectOutlinerPropertyHash::HashProperty(WatchedProperty.Property, Object);
+			if (Hash != WatchedProperty.Hash)
+			{
+				WatchedProperty.Hash = Hash;
+				WatchedProperty.ChangeNum++;
+				WatchedProperty.LastChangeFrame = GFrameCounter;
+				bAnyChanged = true;
+			}
+		}
+
+		if (bAnyChanged)
+		{
+			Entry.ChangeNum++;
+			Entry.LastChangeFrame = GFrameCounter;
+		}
+	}
+	return true;
+}
+}
@@ -0,0 +1,71 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+namespace HazardTools
+{
+struct FObjectOutlinerWatchedProperty
+{
+	// Null once watched object is destroyed, property may be freed by recompile after that
+	const FProperty* Property = nullptr;
+	FName PropertyName; // Kept to display properties of destroyed objects
+	uint32 Hash = 0;
+	int32 ChangeNum = 0;
+	uint64 LastChangeFrame = 0;
+};
+
+struct FObjectOutlinerWatchEntry
+{
+	TWeakObjectPtr<UObject> Object;
+	FString ObjectName; // Kept to display destroyed objects
+
+	// Class the Properties layout was built from, rebuilt if object class changes
+	TWeakObjectPtr<UClass> LayoutClass;
+	TArray<FObjectOutlinerWatchedProperty> Properties;
+
+	// Amount of frames with at least one changed property
+	int32 ChangeNum = 0;
+	uint64 LastChangeFrame = 0;
+};
+
+/**
+ * Objects pinned from the outliner, every frame each top level property is hashed with FObjectOutlinerPropertyHash
+ * and compared to previous frame to count how often it changes.
+ * Ticks only while the list is not empty.
+ */
+class FObjectOutlinerWatchList
+{
+public:
+	static FObjectOutlinerWatchList& Get();
+	static void Shutdown();
+
+	~FObjectOutlinerWatchList();
+
+	void Add(UObject* Object);
+	void Remove(int32 EntryIndex);
+	void Reset();
+	[[nodiscard]] bool Contains(const UObject* Object) const;
+
+	const TArray<FObjectOutlinerWatchEntry>& GetEntries() const { return Entries; }
+
+	// Incremented when entries are added, removed or property layout is rebuilt
+	[[nodiscard]] uint32 GetRevision() const { return Revision; }
+
+private:
+	FObjectOutlinerWatchList() = default;
+
+	bool HandleTick(float DeltaTime);
+	static void BuildLayout(FObjectOutlinerWatchEntry& Entry, const UObject* Object);
+	static void DropLayout(FObjectOutlinerWatchEntry& Entry);
+	void UpdateTicker();
+
+	static TUniquePtr<FObjectOutlinerWatchList> Instance;
+
+	TArray<FObjectOutlinerWatchEntry> Entries;
+	uint32 Revision = 0;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
+}
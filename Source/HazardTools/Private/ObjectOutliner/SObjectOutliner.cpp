@@ -7,8 +7,23 @@
 #include "SObjectOutlinerTableRow.h"
 #include "PropertyEditorModule.h"
 #include "IDetailsView.h"
+#include "ObjectOutlinerAnalysis.h"
+#include "ObjectOutlinerExport.h"
 #include "ObjectOutlinerFilter.h"
+#include "ObjectOutlinerLeakDetector.h"
 #include "ObjectOutlinerModel.h"
+#include "ObjectOutlinerPackageInspector.h"
+#include "ObjectOutlinerPopulationTracker.h"
+#include "ObjectOutlinerPropertyQuery.h"
+#include "ObjectOutlinerSerializedSize.h"
+#include "ObjectOutlinerTextureInfo.h"
+#include "PropertyCustomizationHelpers.h"
+#include "ObjectOutlinerTimeline.h"
+#include "SObjectOutlinerInspector.h"
+#include "SObjectOutlinerReport.h"
+#include "SObjectOutlinerTimeline.h"
+#include "SObjectOutlinerTreemap.h"
+#include "SObjectOutlinerWatchList.h"
 #include "StaticMeshDescription.h"
 #include "ToolMenus.h"
 #include "Algo/ForEach.h"
@@ -16,13 +31,28 @@
 #include "Kismet2/SClassPickerDialog.h"
 #include "Widgets/Input/SSearchBox.h"
 #include "Widgets/Input/SSegmentedControl.h"
+#include "Widgets/Layout/SExpandableArea.h"
+#include "Widgets/Layout/SWidgetSwitcher.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
 #include "HazardToolsObjectOutlinerSettings.h"
+#include "HazardToolsUtils.h"
 
 namespace HazardTools
 {
 const FName SObjectOutliner::Column_ID_Name = "Name";
 const FName SObjectOutliner::Column_ID_Class = "Class";
 const FName SObjectOutliner::Column_ID_Memory = "Memory";
+const FName SObjectOutliner::Column_ID_SerializedSize = "SerializedSize";
+const FName SObjectOutliner::Column_ID_TextureResident = "TextureResident";
+const FName SObjectOutliner::Column_ID_TextureFullSize = "TextureFullSize";
+const FName SObjectOutliner::Column_ID_TextureMips = "TextureMips";
+const FName SObjectOutliner::Column_ID_TextureLODGroup = "TextureLODGroup";
+const FName SObjectOutliner::Column_ID_TextureCompression = "TextureCompression";
+const FName SObjectOutliner::Column_ID_TextureSource = "TextureSource";
+const FName SObjectOutliner::Column_ID_TextureStreaming = "TextureStreaming";
+
+static const FName Filter_Textures = "Filter_Textures";
 
 SObjectOutliner::~SObjectOutliner()
 {
@@ -35,6 +65,7 @@ void SObjectOutliner::Construct(const FArguments& InArgs)
 {
 	GenerateImperativeFilters(ImperativeFilters);
 	GenerateDropDownFilters(DropDownFilters);
+	GenerateAnalyses(Analyses);
 
 	//DisplayMode = EDisplayMode::List;
 	//SortByColumn = NAME_Name;
@@ -63,6 +94,7 @@ void SObjectOutliner::Construct(const FArguments& InArgs)
 	Model = MakeShared<FObjectOutlinerModel>()
 	        ->SetShouldPassFilter(FObjectOutlinerModel::FShouldPassItem::CreateSP(this, &SObjectOutliner::ShouldItemPassFilter))
 	        ->SetShouldPassTextFilter(FObjectOutlinerModel::FShouldPassItem::CreateSP(this, &SObjectOutliner::ShouldItemPassTextFilter));
+	Model->SetTopNBySize(SettingsClass::Get().bShowTopNBySize ? SettingsClass::Get().TopNBySizeNum : 0);
 
 	const TSharedRef<SVerticalBox> LeftPanelVerticalBox = SNew(SVerticalBox);
 
@@ -73,6 +105,14 @@ void SObjectOutliner::Construct(const FArguments& InArgs)
 		MakeToolbar()
 	];
 
+	// Property value search
+	LeftPanelVerticalBox->AddSlot()
+	                    .AutoHeight()
+	                    .Padding(8.0f, 0.0f, 8.0f, 4.0f)
+	[
+		MakePropertySearchRow()
+	];
+
 	// Tree / List view
 	LeftPanelVerticalBox->AddSlot()
 	                    .FillHeight(1.0f)
@@ -85,6 +125,30 @@ void SObjectOutliner::Construct(const FArguments& InArgs)
 		]
 	];
 
+	// Object count timeline
+	LeftPanelVerticalBox->AddSlot()
+	                    .AutoHeight()
+	[
+		MakeTimelineArea()
+	];
+
+	// Watched objects
+	LeftPanelVerticalBox->AddSlot()
+	                    .AutoHeight()
+	[
+		SNew(SExpandableArea)
+		.InitiallyCollapsed(true)
+		.AreaTitle(INVTEXT("Watch List"))
+		.BodyContent()
+		[
+			SNew(SBox)
+			.HeightOverride(220.f)
+			[
+				SNew(SObjectOutlinerWatchList)
+			]
+		]
+	];
+
 	// Bottom panel status bar
 	LeftPanelVerticalBox->AddSlot()
 	                    .AutoHeight()
@@ -117,6 +181,20 @@ void SObjectOutliner::Construct(const FArguments& InArgs)
 			]
 		]
 
+		// Collapsed slots are skipped by splitter
+		+ SSplitter::Slot()
+		.Value(2)
+		[
+			SNew(SBorder)
+			.Padding(FMargin(3))
+			.BorderImage(FAppStyle::Get().GetBrush("ToolPanel.GroupBorder"))
+			.Visibility_Lambda([]() { return SettingsClass::Get().bShowTreemap ? EVisibility::Visible : EVisibility::Collapsed; })
+			[
+				SAssignNew(Treemap, SObjectOutlinerTreemap)
+				.OnItemClicked(this, &ThisClass::SelectItem)
+			]
+		]
+
 		+ SSplitter::Slot()
 		.Value(1)
 		[
@@ -124,12 +202,24 @@ void SObjectOutliner::Construct(const FArguments& InArgs)
 			.Padding(FMargin(3))
 			.BorderImage(FAppStyle::Get().GetBrush("ToolPanel.GroupBorder"))
 			[
-				MakePropertyEditor()
+				SNew(SWidgetSwitcher)
+				.WidgetIndex_Lambda([]() { return SettingsClass::Get().bUseFastInspector ? 1 : 0; })
+
+				+ SWidgetSwitcher::Slot()
+				[
+					MakePropertyEditor()
+				]
+
+				+ SWidgetSwitcher::Slot()
+				[
+					SAssignNew(Inspector, SObjectOutlinerInspector)
+				]
 			]
 		]
 	];
 
-	Populate();
+	// Don't scan objects during layout restore on editor startup, see HandleDeferredPopulate
+	RegisterActiveTimer(0.1f, FWidgetActiveTimerDelegate::CreateSP(this, &ThisClass::HandleDeferredPopulate));
 }
 
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
@@ -149,7 +239,13 @@ TAttribute<FText> SObjectOutliner::GetTextFilterHighlightText() const
 
 bool SObjectOutliner::IsTreeViewMode()
 {
-	return static_cast<EDisplayMode>(SettingsClass::Get().DisplayMode) == EDisplayMode::Tree;
+	return GetDisplayMode() != EDisplayMode::List;
+}
+
+EDisplayMode SObjectOutliner::GetDisplayMode()
+{
+	const uint8 DisplayMode = SettingsClass::Get().DisplayMode;
+	return DisplayMode <= static_cast<uint8>(EDisplayMode::Packages) ? static_cast<EDisplayMode>(DisplayMode) : EDisplayMode::List;
 }
 
 // ReSharper disable once CppMemberFunctionMayBeStatic
@@ -159,13 +255,34 @@ void SObjectOutliner::PopulateSearchStrings(const UObject& TreeItem, TArray<FStr
 	OutSearchStrings.Emplace(TreeItem.GetName());
 }
 
+EActiveTimerReturnType SObjectOutliner::HandleDeferredPopulate(double InCurrentTime, float InDeltaTime)
+{
+	if (FHazardToolsUtils::IsEditorIdle() == false)
+	{
+		return EActiveTimerReturnType::Continue;
+	}
+
+	bPopulatePending = false;
+	Populate();
+	return EActiveTimerReturnType::Stop;
+}
+
 void SObjectOutliner::Populate() const
 {
+	// Settings changed before first population will be picked up by it
+	if (bPopulatePending)
+	{
+		return;
+	}
+
 	// Keep selection
-	TWeakObjectPtr<UObject> SelectedObject;
-	if (TreeView->GetNumItemsSelected() > 0 && TreeView->GetSelectedItems()[0].IsValid())
+	TArray<TWeakObjectPtr<UObject>> SelectedObjects;
+	for (const FObjectOutlinerItemPtr& SelectedItem : TreeView->GetSelectedItems())
 	{
-		SelectedObject = TreeView->GetSelectedItems()[0].Get()->ObjectPtr;
+		if (SelectedItem.IsValid())
+		{
+			SelectedObjects.Add(SelectedItem->ObjectPtr);
+		}
 	}
 
 	// Keep expansion state
@@ -183,8 +300,10 @@ void SObjectOutliner::Populate() const
 		}
 	}
 
+	UpdateTextureColumnsVisibility();
+
 	TMap<UObject*, FObjectOutlinerItemPtr> ProcessedObjectsMap;
-	Model->UpdateContent(IsTreeViewMode(), &ProcessedObjectsMap);
+	Model->UpdateContent(GetDisplayMode(), &ProcessedObjectsMap);
 
 	SortItems(Model->GetMutableRootContent());
 
@@ -200,27 +319,98 @@ void SObjectOutliner::Populate() const
 		}
 	}
 
-	//Restore selection
-	if (SelectedObject.IsValid())
+	//Restore selection, all items at once so selection changed is signaled once
+	TArray<FObjectOutlinerItemPtr> ItemsToSelect;
+	ItemsToSelect.Reserve(SelectedObjects.Num());
+	for (const TWeakObjectPtr<UObject>& SelectedObject : SelectedObjects)
+	{
+		if (const FObjectOutlinerItemPtr* SelectedItemPtr = ProcessedObjectsMap.Find(SelectedObject.Get()))
+		{
+			ItemsToSelect.Add(*SelectedItemPtr);
+		}
+	}
+	if (ItemsToSelect.Num() > 0)
 	{
-		if (const FObjectOutlinerItemPtr* LastSelectedItemPtr = ProcessedObjectsMap.Find(SelectedObject.Get()))
+		TreeView->SetItemSelection(ItemsToSelect, true);
+
+		// If first selected item is inside tree expand it too
+		FObjectOutlinerItemPtr LastSelectedItem = ItemsToSelect[0];
+		if (IsTreeViewMode())
 		{
-			FObjectOutlinerItemPtr LastSelectedItem = *LastSelectedItemPtr;
-			TreeView->SetItemSelection(LastSelectedItem, true);
-			// If selected item inside tree expand it too
-			if (IsTreeViewMode())
+			while (LastSelectedItem->Parent.IsValid())
 			{
-				while (LastSelectedItem->Parent.IsValid())
-				{
-					TreeView->SetItemExpansion(LastSelectedItem->Parent.Pin(), true);
-					LastSelectedItem = LastSelectedItem->Parent.Pin();
-				}
+				TreeView->SetItemExpansion(LastSelectedItem->Parent.Pin(), true);
+				LastSelectedItem = LastSelectedItem->Parent.Pin();
 			}
-			TreeView->RequestScrollIntoView(LastSelectedItem);
 		}
+		TreeView->RequestScrollIntoView(LastSelectedItem);
 	}
 
 	TreeView->RequestTreeRefresh();
+
+	if (SettingsClass::Get().bShowTreemap)
+	{
+		Treemap->SetItems(Model->GetRootContent(), GetDisplayMode());
+	}
+
+	RequestSerializedSizes();
+}
+
+void SObjectOutliner::SelectItem(const FObjectOutlinerItemPtr Item) const
+{
+	FObjectOutlinerItemPtr Parent = Item->GetParent();
+	while (Parent.IsValid())
+	{
+		TreeView->SetItemExpansion(Parent, true);
+		Parent = Parent->GetParent();
+	}
+	TreeView->SetSelection(Item);
+	TreeView->RequestScrollIntoView(Item);
+}
+
+void SObjectOutliner::RequestSerializedSizes() const
+{
+	if (HeaderRowWidget->IsColumnVisible(Column_ID_SerializedSize))
+	{
+		TArray<TWeakObjectPtr<UObject>> Objects;
+		Objects.Reserve(Model->GetDisplayedNum());
+		GatherDisplayedObjects(Model->GetRootContent(), Objects);
+		FObjectOutlinerSerializedSizeCache::Get().RequestBackground(MoveTemp(Objects));
+	}
+}
+
+bool SObjectOutliner::IsTextureColumn(const FName ColumnId)
+{
+	return ColumnId == Column_ID_TextureResident
+	       || ColumnId == Column_ID_TextureFullSize
+	       || ColumnId == Column_ID_TextureMips
+	       || ColumnId == Column_ID_TextureLODGroup
+	       || ColumnId == Column_ID_TextureCompression
+	       || ColumnId == Column_ID_TextureSource
+	       || ColumnId == Column_ID_TextureStreaming;
+}
+
+bool SObjectOutliner::IsDropDownFilterEnabled(const FName FilterName) const
+{
+	return DropDownFilters.ContainsByPredicate([FilterName](const TSharedPtr<FObjectOutlinerFilter>& Filter)
+	{
+		return Filter->bEnabled && Filter->FilterName == FilterName;
+	});
+}
+
+void SObjectOutliner::UpdateTextureColumnsVisibility() const
+{
+	const bool bTexturesFilterEnabled = IsDropDownFilterEnabled(Filter_Textures);
+
+	// Only on change, so columns hidden by user from header menu stay hidden while filter is on
+	if (bTexturesFilterEnabled != bTextureColumnsVisible)
+	{
+		bTextureColumnsVisible = bTexturesFilterEnabled;
+		for (const FName ColumnId : {Column_ID_TextureResident, Column_ID_TextureFullSize, Column_ID_TextureMips, Column_ID_TextureLODGroup, Column_ID_TextureCompression, Column_ID_TextureSource, Column_ID_TextureStreaming})
+		{
+			HeaderRowWidget->SetShowGeneratedColumn(ColumnId, bTexturesFilterEnabled);
+		}
+	}
 }
 
 TSharedRef<ITableRow> SObjectOutliner::HandleListGenerateRow(const FObjectOutlinerItemPtr ObjectPtr, const TSharedRef<STableViewBase>& OwnerTable)
@@ -241,10 +431,9 @@ TSharedPtr<SWidget> SObjectOutliner::GetContextMenuContent() const
 	const FToolMenuContext Context(nullptr, TSharedPtr<FExtender>());
 	UToolMenu* Menu = ToolMenus->GenerateMenu(MenuName, Context);
 
-	if (TreeView->GetNumItemsSelected() > 0 && TreeView->GetSelectedItems()[0].IsValid())
+	if (TreeView->GetNumItemsSelected() > 0)
 	{
-		const FObjectOutlinerItemPtr ObjectOutlinerItem = TreeView->GetSelectedItems()[0];
-		FObjectOutlinerItemActions::GenerateContextMenu(Menu, ObjectOutlinerItem);
+		FObjectOutlinerItemActions::GenerateContextMenu(Menu, TreeView->GetSelectedItems());
 	}
 
 	TSharedRef<SWidget> MenuWidget = ToolMenus->GenerateWidget(Menu);
@@ -252,13 +441,46 @@ TSharedPtr<SWidget> SObjectOutliner::GetContextMenuContent() const
 }
 
 
-void SObjectOutliner::HandleListSelectionChanged(const FObjectOutlinerItemPtr InItem, ESelectInfo::Type /*SelectInfo*/) const
+void SObjectOutliner::HandleListSelectionChanged(const FObjectOutlinerItemPtr InItem, ESelectInfo::Type /*SelectInfo*/)
 {
 	if (!InItem.IsValid())
 	{
 		return;
 	}
-	PropertyEditor->SetObject(InItem.Get()->ObjectPtr.Get());
+	InspectedObject = InItem->ObjectPtr;
+
+	// Details view rebuild takes tens to hundreds of ms, wait until selection settles (e.g. scrolling with arrow keys)
+	CancelDetailsDebounce();
+
+	if (SettingsClass::Get().bUseFastInspector)
+	{
+		Inspector->SetObject(InspectedObject.Get());
+		return;
+	}
+
+	const float DebounceSeconds = SettingsClass::Get().DetailsViewDebounceSeconds;
+	if (DebounceSeconds <= 0.f)
+	{
+		PropertyEditor->SetObject(InspectedObject.Get());
+		return;
+	}
+	DetailsDebounceTimerHandle = RegisterActiveTimer(DebounceSeconds, FWidgetActiveTimerDelegate::CreateSP(this, &ThisClass::HandleDetailsDebounce));
+}
+
+EActiveTimerReturnType SObjectOutliner::HandleDetailsDebounce(double InCurrentTime, float InDeltaTime)
+{
+	DetailsDebounceTimerHandle.Reset();
+	PropertyEditor->SetObject(InspectedObject.Get());
+	return EActiveTimerReturnType::Stop;
+}
+
+void SObjectOutliner::CancelDetailsDebounce()
+{
+	if (DetailsDebounceTimerHandle.IsValid())
+	{
+		UnRegisterActiveTimer(DetailsDebounceTimerHandle.ToSharedRef());
+		DetailsDebounceTimerHandle.Reset();
+	}
 }
 
 TSharedRef<SWidget> SObjectOutliner::GetDropDownFiltersButtonContent()
@@ -319,6 +541,72 @@ TSharedRef<SWidget> SObjectOutliner::GetDropDownFiltersButtonContent()
 			EUserInterfaceActionType::ToggleButton
 			);
 
+		MenuBuilder.AddMenuEntry(
+			FText::Format(INVTEXT("Top {0} by Size"), FText::AsNumber(SettingsClass::Get().TopNBySizeNum)),
+			INVTEXT("Show only biggest objects (exclusive resource size) passing current filters"),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateLambda(
+					[&]()
+					{
+						SettingsClass::GetMutable().bShowTopNBySize = !SettingsClass::Get().bShowTopNBySize;
+						Model->SetTopNBySize(SettingsClass::Get().bShowTopNBySize ? SettingsClass::Get().TopNBySizeNum : 0);
+						Populate();
+					}),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateLambda([&]() { return SettingsClass::Get().bShowTopNBySize; })
+				),
+			NAME_None,
+			EUserInterfaceActionType::ToggleButton
+			);
+
+		MenuBuilder.AddMenuEntry(
+			INVTEXT("Show Treemap"),
+			INVTEXT("Show memory treemap of displayed objects next to the list"),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateLambda(
+					[&]()
+					{
+						SettingsClass::GetMutable().bShowTreemap = !SettingsClass::Get().bShowTreemap;
+						if (SettingsClass::Get().bShowTreemap)
+						{
+							Treemap->SetItems(Model->GetRootContent(), GetDisplayMode());
+						}
+					}),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateLambda([&]() { return SettingsClass::Get().bShowTreemap; })
+				),
+			NAME_None,
+			EUserInterfaceActionType::ToggleButton
+			);
+
+		MenuBuilder.AddMenuEntry(
+			INVTEXT("Fast Inspector"),
+			INVTEXT("Show selected object in read only virtualized property list instead of details view, values are read when their row is first shown and updated by its refresh button"),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateLambda(
+					[&]()
+					{
+						CancelDetailsDebounce();
+						SettingsClass::GetMutable().bUseFastInspector = !SettingsClass::Get().bUseFastInspector;
+						if (SettingsClass::Get().bUseFastInspector)
+						{
+							Inspector->SetObject(InspectedObject.Get());
+						}
+						else
+						{
+							PropertyEditor->SetObject(InspectedObject.Get());
+						}
+					}),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateLambda([&]() { return SettingsClass::Get().bUseFastInspector; })
+				),
+			NAME_None,
+			EUserInterfaceActionType::ToggleButton
+			);
+
 		MenuBuilder.AddMenuEntry(
 			INVTEXT("Toggle All"),
 			INVTEXT("Toggle On/Off all filters"),
@@ -329,10 +617,175 @@ TSharedRef<SWidget> SObjectOutliner::GetDropDownFiltersButtonContent()
 	}
 	MenuBuilder.EndSection();
 
+	MenuBuilder.BeginSection(NAME_None, INVTEXT("Reports"));
+	{
+		MenuBuilder.AddMenuEntry(
+			INVTEXT("Last PIE Leak Report"),
+			INVTEXT("Objects which survived last Play In Editor session"),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateLambda([]()
+				{
+					if (const FObjectOutlinerLeakDetector* LeakDetector = FObjectOutlinerLeakDetector::Get())
+					{
+						SObjectOutlinerReport::OpenWindow(LeakDetector->GetLastReport().ToSharedRef());
+					}
+				}),
+				FCanExecuteAction::CreateLambda([]()
+				{
+					const FObjectOutlinerLeakDetector* LeakDetector = FObjectOutlinerLeakDetector::Get();
+					return LeakDetector != nullptr && LeakDetector->GetLastReport().IsValid();
+				})
+				),
+			NAME_None
+			);
+
+		MenuBuilder.AddMenuEntry(
+			INVTEXT("Inspect Package Files..."),
+			INVTEXT("List exports of .uasset/.umap files read directly from disk, without loading them"),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([&]() { FObjectOutlinerPackageInspector::PickAndInspectPackages(AsShared()); })),
+			NAME_None
+			);
+	}
+	MenuBuilder.EndSection();
+
 	return MenuBuilder.MakeWidget();
 }
 
 
+TSharedRef<SWidget> SObjectOutliner::GetAnalyzeMenuContent()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+
+	MenuBuilder.BeginSection(NAME_None, INVTEXT("Analyze Displayed Objects"));
+	{
+		for (const TSharedPtr<FObjectOutlinerAnalysis>& Analysis : Analyses)
+		{
+			FText Tooltip = Analysis->Tooltip;
+			if (Analysis->RequiredFilterName.IsNone() == false)
+			{
+				const TSharedPtr<FObjectOutlinerFilter>* RequiredFilter = DropDownFilters.FindByPredicate([&](const TSharedPtr<FObjectOutlinerFilter>& Filter) { return Filter->FilterName == Analysis->RequiredFilterName; });
+				if (RequiredFilter != nullptr)
+				{
+					Tooltip = FText::Format(INVTEXT("{0}\nRequires \"{1}\" filter"), Tooltip, (*RequiredFilter)->Title);
+				}
+			}
+
+			MenuBuilder.AddMenuEntry(
+				Analysis->Title,
+				Tooltip,
+				FSlateIcon(),
+				FUIAction(
+					FExecuteAction::CreateLambda([&, Analysis]()
+					{
+						if (const TSharedPtr<FObjectOutlinerReport> Report = RunAnalysis(Analysis))
+						{
+							SObjectOutlinerReport::OpenWindow(Report.ToSharedRef(), FObjectOutlinerReportGenerator::CreateSP(this, &ThisClass::RunAnalysis, Analysis));
+						}
+					}),
+					FCanExecuteAction::CreateLambda([&, Analysis]() { return Analysis->RequiredFilterName.IsNone() || IsDropDownFilterEnabled(Analysis->RequiredFilterName); })
+					)
+				);
+		}
+	}
+	MenuBuilder.EndSection();
+
+	return MenuBuilder.MakeWidget();
+}
+
+TSharedPtr<FObjectOutlinerReport> SObjectOutliner::RunAnalysis(const TSharedPtr<FObjectOutlinerAnalysis> Analysis) const
+{
+	TArray<TWeakObjectPtr<UObject>> DisplayedObjects;
+	DisplayedObjects.Reserve(Model->GetDisplayedNum());
+	GatherDisplayedObjects(Model->GetRootContent(), DisplayedObjects);
+
+	TArray<UObject*> Objects;
+	Objects.Reserve(DisplayedObjects.Num());
+	for (const TWeakObjectPtr<UObject>& WeakObject : DisplayedObjects)
+	{
+		if (UObject* Object = WeakObject.Get())
+		{
+			Objects.Add(Object);
+		}
+	}
+
+	return Analysis->Run(Objects);
+}
+
+TSharedRef<SWidget> SObjectOutliner::GetWorldScopeMenuContent()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+
+	MenuBuilder.BeginSection(NAME_None, INVTEXT("World Scope"));
+	{
+		MenuBuilder.AddMenuEntry(
+			INVTEXT("All Worlds"),
+			INVTEXT("Show all objects"),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateLambda([&]()
+				{
+					Model->SetWorldScope(nullptr);
+					Populate();
+				}),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateLambda([&]() { return Model->GetWorldScope() == nullptr; })
+				),
+			NAME_None,
+			EUserInterfaceActionType::RadioButton
+			);
+
+		TArray<UWorld*> Worlds;
+		FObjectOutlinerModel::GetScopeWorlds(Worlds);
+
+		const FObjectOutlinerPopulationTracker* Tracker = FObjectOutlinerPopulationTracker::Get();
+		for (UWorld* World : Worlds)
+		{
+			const TWeakObjectPtr<UWorld> WeakWorld = World;
+			const FText Tooltip = Tracker != nullptr
+				                      ? FText::Format(INVTEXT("{0}\nIndexed objects: {1}"), FText::FromString(World->GetPathName()), FText::AsNumber(Tracker->GetWorldObjectsNum(World)))
+				                      : FText::FromString(World->GetPathName());
+			MenuBuilder.AddMenuEntry(
+				GetWorldDisplayText(World),
+				Tooltip,
+				FSlateIcon(),
+				FUIAction(
+					FExecuteAction::CreateLambda([&, WeakWorld]()
+					{
+						if (WeakWorld.IsValid())
+						{
+							Model->SetWorldScope(WeakWorld.Get());
+							Populate();
+						}
+					}),
+					FCanExecuteAction(),
+					FIsActionChecked::CreateLambda([&, WeakWorld]() { return WeakWorld.IsValid() && Model->GetWorldScope() == WeakWorld.Get(); })
+					),
+				NAME_None,
+				EUserInterfaceActionType::RadioButton
+				);
+		}
+	}
+	MenuBuilder.EndSection();
+
+	return MenuBuilder.MakeWidget();
+}
+
+FText SObjectOutliner::GetWorldScopeText() const
+{
+	if (const UWorld* World = Model->GetWorldScope())
+	{
+		return GetWorldDisplayText(World);
+	}
+	return INVTEXT("All Worlds");
+}
+
+FText SObjectOutliner::GetWorldDisplayText(const UWorld* World)
+{
+	return FText::Format(INVTEXT("{0} ({1})"), FText::FromString(World->GetName()), FText::FromString(LexToString(World->WorldType)));
+}
+
 void SObjectOutliner::HandleToggleAllDropDownFilters()
 {
 	const int32 EnabledFiltersNum = Algo::Accumulate(DropDownFilters, 0, [](const int32 Sum, const TSharedPtr<FObjectOutlinerFilter> Filter) { return Sum + Filter->bEnabled; });
@@ -368,7 +821,7 @@ TSharedRef<SHorizontalBox> SObjectOutliner::MakeToolbar()
 	       .AutoWidth()
 	[
 		SNew(SSegmentedControl<HazardTools::EDisplayMode>)
-		.Value_Lambda([&]() { return static_cast<EDisplayMode>(SettingsClass::Get().DisplayMode); })
+		.Value_Lambda([&]() { return GetDisplayMode(); })
 		.OnValueChanged_Lambda([&](const EDisplayMode NewDisplayMode)
 		{
 			SettingsClass::GetMutable().DisplayMode = static_cast<uint8>(NewDisplayMode);
@@ -402,6 +855,50 @@ TSharedRef<SHorizontalBox> SObjectOutliner::MakeToolbar()
 				.Image(FAppStyle::Get().GetBrush("ContentBrowser.ShowSourcesView"))
 			]
 		]
+
+		+ SSegmentedControl<EDisplayMode>::Slot(EDisplayMode::ClassTree)
+		.ToolTip(INVTEXT("Class hierarchy view, instance count and memory are rolled up through subclasses"))
+		[
+			SNew(SBox)
+			.HeightOverride(16.f)
+			.WidthOverride(16.f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SImage)
+				.ColorAndOpacity(FSlateColor::UseForeground())
+				.Image(FAppStyle::Get().GetBrush("ClassIcon.Class"))
+			]
+		]
+
+		+ SSegmentedControl<EDisplayMode>::Slot(EDisplayMode::Packages)
+		.ToolTip(INVTEXT("Package view, object count and memory are summed for everything inside each outermost package"))
+		[
+			SNew(SBox)
+			.HeightOverride(16.f)
+			.WidthOverride(16.f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SImage)
+				.ColorAndOpacity(FSlateColor::UseForeground())
+				.Image(FAppStyle::Get().GetBrush("ClassIcon.Package"))
+			]
+		]
+	];
+
+	// World scope
+	Toolbar->AddSlot()
+	       .VAlign(VAlign_Center)
+	       .AutoWidth()
+	       .Padding(4.f, 0.f)
+	[
+		SNew(SComboButton)
+		.ToolTipText(INVTEXT("Show only objects inside selected world and its streaming levels"))
+		.OnGetMenuContent(this, &ThisClass::GetWorldScopeMenuContent)
+		.ButtonContent()
+		[
+			SNew(STextBlock)
+			.Text(this, &ThisClass::GetWorldScopeText)
+		]
 	];
 
 	Toolbar->AddSlot()
@@ -431,6 +928,59 @@ TSharedRef<SHorizontalBox> SObjectOutliner::MakeToolbar()
 		]
 	];
 
+	// Property search toggle
+	Toolbar->AddSlot()
+	       .VAlign(VAlign_Center)
+	       .AutoWidth()
+	       .Padding(4.f, 0.f, 0.f, 0.f)
+	[
+		SNew(SCheckBox)
+		.Style(&FAppStyle::Get().GetWidgetStyle<FCheckBoxStyle>("ToggleButtonCheckBox"))
+		.ToolTipText(INVTEXT("Search instances of a class by property value"))
+		.IsChecked_Lambda([&]() { return bPropertySearchVisible ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+		.OnCheckStateChanged_Lambda([&](const ECheckBoxState NewState) { bPropertySearchVisible = NewState == ECheckBoxState::Checked; })
+		[
+			SNew(SImage)
+			.ColorAndOpacity(FSlateColor::UseForeground())
+			.Image(FAppStyle::Get().GetBrush("Icons.Search"))
+		]
+	];
+
+	// Analyses
+	Toolbar->AddSlot()
+	       .VAlign(VAlign_Center)
+	       .AutoWidth()
+	       .Padding(4.f, 0.f, 0.f, 0.f)
+	[
+		SNew(SComboButton)
+		.ComboButtonStyle(FAppStyle::Get(), "SimpleComboButton")
+		.ToolTipText(INVTEXT("Run analysis on currently displayed objects"))
+		.OnGetMenuContent(this, &ThisClass::GetAnalyzeMenuContent)
+		.ButtonContent()
+		[
+			SNew(SImage)
+			.ColorAndOpacity(FSlateColor::UseForeground())
+			.Image(FAppStyle::Get().GetBrush("LevelEditor.Tabs.StatsViewer"))
+		]
+	];
+
+	// Export button
+	Toolbar->AddSlot()
+	       .VAlign(VAlign_Center)
+	       .AutoWidth()
+	       .Padding(4.f, 0.f, 0.f, 0.f)
+	[
+		SNew(SButton)
+		.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+		.ToolTipText(INVTEXT("Export objects matching current filters to CSV or JSON file, outer rows shown in tree mode only for hierarchy are left out"))
+		.OnClicked(this, &ThisClass::OnExportClicked)
+		[
+			SNew(SImage)
+			.ColorAndOpacity(FSlateColor::UseForeground())
+			.Image(FAppStyle::Get().GetBrush("Icons.Save"))
+		]
+	];
+
 	Toolbar->AddSlot()
 	       .VAlign(VAlign_Center)
 	       .AutoWidth()
@@ -500,10 +1050,222 @@ TSharedRef<SHorizontalBox> SObjectOutliner::MakeImperativeFilterButtons()
 }
 
 
+TSharedRef<SWidget> SObjectOutliner::MakeTimelineArea()
+{
+	return SNew(SExpandableArea)
+		.InitiallyCollapsed(true)
+		.AreaTitle(INVTEXT("Object Count Timeline"))
+		.BodyContent()
+		[
+			SNew(SOverlay)
+
+			+ SOverlay::Slot()
+			[
+				SNew(SBox)
+				.HeightOverride(160.f)
+				[
+					SNew(SObjectOutlinerTimeline)
+				]
+			]
+
+			+ SOverlay::Slot()
+			.HAlign(HAlign_Right)
+			.VAlign(VAlign_Top)
+			.Padding(4.f)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+				.ToolTipText(INVTEXT("Save timeline samples to Saved/HazardTools folder"))
+				.IsEnabled_Lambda([]() { return FObjectOutlinerTimeline::Get() != nullptr; })
+				.OnClicked(this, &ThisClass::OnSaveTimelineClicked)
+				[
+					SNew(SImage)
+					.ColorAndOpacity(FSlateColor::UseForeground())
+					.Image(FAppStyle::Get().GetBrush("Icons.Save"))
+				]
+			]
+		];
+}
+
+TSharedRef<SWidget> SObjectOutliner::MakePropertySearchRow()
+{
+	return SNew(SHorizontalBox)
+		.Visibility_Lambda([&]() { return bPropertySearchVisible ? EVisibility::Visible : EVisibility::Collapsed; })
+
+		+ SHorizontalBox::Slot()
+		.VAlign(VAlign_Center)
+		.FillWidth(0.35f)
+		[
+			SNew(SClassPropertyEntryBox)
+			.MetaClass(UObject::StaticClass())
+			.AllowAbstract(true)
+			.AllowNone(false)
+			.SelectedClass_Lambda([&]() -> const UClass* { return PropertySearchClass.Get(); })
+			.OnSetClass_Lambda([&](const UClass* NewClass)
+			{
+				PropertySearchClass = const_cast<UClass*>(NewClass);
+				if (NewClass == nullptr || FindFProperty<FProperty>(NewClass, PropertySearchPropertyName) == nullptr)
+				{
+					PropertySearchPropertyName = NAME_None;
+				}
+			})
+		]
+
+		+ SHorizontalBox::Slot()
+		.VAlign(VAlign_Center)
+		.FillWidth(0.3f)
+		.Padding(4.f, 0.f, 0.f, 0.f)
+		[
+			SNew(SComboButton)
+			.IsEnabled_Lambda([&]() { return PropertySearchClass.IsValid(); })
+			.OnGetMenuContent(this, &ThisClass::GetPropertySearchMenuContent)
+			.ButtonContent()
+			[
+				SNew(STextBlock)
+				.Text(this, &ThisClass::GetPropertySearchPropertyText)
+			]
+		]
+
+		+ SHorizontalBox::Slot()
+		.VAlign(VAlign_Center)
+		.FillWidth(0.35f)
+		.Padding(4.f, 0.f, 0.f, 0.f)
+		[
+			SAssignNew(PropertySearchValueBox, SEditableTextBox)
+			.HintText(INVTEXT("Value (as in Copy/Paste, e.g. True, 2.5, TEXTUREGROUP_UI)"))
+			.OnTextCommitted_Lambda([&](const FText&, const ETextCommit::Type CommitType)
+			{
+				if (CommitType == ETextCommit::OnEnter)
+				{
+					OnPropertySearchClicked();
+				}
+			})
+		]
+
+		+ SHorizontalBox::Slot()
+		.VAlign(VAlign_Center)
+		.AutoWidth()
+		.Padding(4.f, 0.f, 0.f, 0.f)
+		[
+			SNew(SButton)
+			.Text(INVTEXT("Search"))
+			.IsEnabled_Lambda([&]() { return PropertySearchClass.IsValid() && PropertySearchPropertyName != NAME_None; })
+			.OnClicked(this, &ThisClass::OnPropertySearchClicked)
+		]
+
+		+ SHorizontalBox::Slot()
+		.VAlign(VAlign_Center)
+		.AutoWidth()
+		.Padding(4.f, 0.f, 0.f, 0.f)
+		[
+			SNew(SButton)
+			.Text(INVTEXT("Clear"))
+			.IsEnabled_Lambda([&]() { return Model->GetPropertyQuery().IsValid(); })
+			.OnClicked(this, &ThisClass::OnPropertySearchClearClicked)
+		];
+}
+
+TSharedRef<SWidget> SObjectOutliner::GetPropertySearchMenuContent()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+
+	if (const UClass* Class = PropertySearchClass.Get())
+	{
+		TArray<const FProperty*> Properties;
+		for (TFieldIterator<FProperty> It(Class); It; ++It)
+		{
+			Properties.Add(*It);
+		}
+		Properties.Sort([](const FProperty& A, const FProperty& B) { return A.GetName() < B.GetName(); });
+
+		MenuBuilder.BeginSection(NAME_None, INVTEXT("Property"));
+		for (const FProperty* Property : Properties)
+		{
+			const FName PropertyName = Property->GetFName();
+			MenuBuilder.AddMenuEntry(
+				FText::FromName(PropertyName),
+				FText::Format(INVTEXT("{0} {1}::{2}"), FText::FromString(Property->GetCPPType()), FText::FromString(Property->GetOwnerVariant().GetName()), FText::FromName(PropertyName)),
+				FSlateIcon(),
+				FUIAction(
+					FExecuteAction::CreateLambda([&, PropertyName]() { PropertySearchPropertyName = PropertyName; }),
+					FCanExecuteAction(),
+					FIsActionChecked::CreateLambda([&, PropertyName]() { return PropertySearchPropertyName == PropertyName; })
+					),
+				NAME_None,
+				EUserInterfaceActionType::RadioButton
+				);
+		}
+		MenuBuilder.EndSection();
+	}
+
+	return MenuBuilder.MakeWidget();
+}
+
+FText SObjectOutliner::GetPropertySearchPropertyText() const
+{
+	return PropertySearchPropertyName != NAME_None ? FText::FromName(PropertySearchPropertyName) : INVTEXT("Select Property");
+}
+
+FReply SObjectOutliner::OnPropertySearchClicked()
+{
+	UClass* Class = PropertySearchClass.Get();
+	const FProperty* Property = Class != nullptr ? FindFProperty<FProperty>(Class, PropertySearchPropertyName) : nullptr;
+	if (Property == nullptr)
+	{
+		PropertySearchValueBox->SetError(INVTEXT("Select class and property"));
+		return FReply::Handled();
+	}
+
+	const TSharedRef<FObjectOutlinerPropertyQuery> Query = MakeShared<FObjectOutlinerPropertyQuery>(Class, Property);
+
+	FText Error;
+	if (Query->SetValueText(PropertySearchValueBox->GetText().ToString(), Error) == false)
+	{
+		PropertySearchValueBox->SetError(Error);
+		return FReply::Handled();
+	}
+
+	PropertySearchValueBox->SetError(FText::GetEmpty());
+	Model->SetPropertyQuery(Query);
+	Populate();
+	return FReply::Handled();
+}
+
+FReply SObjectOutliner::OnPropertySearchClearClicked()
+{
+	PropertySearchValueBox->SetError(FText::GetEmpty());
+	Model->SetPropertyQuery(nullptr);
+	Populate();
+	return FReply::Handled();
+}
+
+FReply SObjectOutliner::OnSaveTimelineClicked() const
+{
+	if (const FObjectOutlinerTimeline* Timeline = FObjectOutlinerTimeline::Get())
+	{
+		const FString Filename = FObjectOutlinerTimeline::GetDefaultSaveFilename();
+		const bool bSuccess = Timeline->SaveToFile(Filename);
+
+		FNotificationInfo Info(bSuccess ? INVTEXT("Object count timeline saved") : INVTEXT("Failed to save object count timeline"));
+		Info.ExpireDuration = 5.0f;
+		if (bSuccess)
+		{
+			Info.Hyperlink = FSimpleDelegate::CreateLambda([Filename]() { FPlatformProcess::ExploreFolder(*Filename); });
+			Info.HyperlinkText = FText::FromString(FPaths::GetCleanFilename(Filename));
+		}
+		if (const TSharedPtr<SNotificationItem> InfoItem = FSlateNotificationManager::Get().AddNotification(Info))
+		{
+			InfoItem->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+		}
+	}
+	return FReply::Handled();
+}
+
 TSharedRef<SWidget> SObjectOutliner::MakeTreeView()
 {
 	SAssignNew(HeaderRowWidget, SHeaderRow)
 		.CanSelectGeneratedColumn(true)
+		.OnHiddenColumnsListChanged(this, &ThisClass::RequestSerializedSizes)
 
 		+ SHeaderRow::Column(Column_ID_Name)
 		  .DefaultLabel(INVTEXT("Name"))
@@ -525,13 +1287,84 @@ TSharedRef<SWidget> SObjectOutliner::MakeTreeView()
 		  .OnSort(this, &ThisClass::OnColumnSortModeChanged)
 		  .FillWidth(0.1)
 		  .HAlignCell(HAlign_Right)
-		  .HAlignHeader(HAlign_Right);
+		  .HAlignHeader(HAlign_Right)
+
+		+ SHeaderRow::Column(Column_ID_SerializedSize)
+		  .DefaultLabel(INVTEXT("Serialized (Memory)"))
+		  .DefaultTooltip(INVTEXT("Bytes object Serialize writes into a non persistent in-memory archive, as used by duplication and undo. Not the on-disk or cooked size: transient properties are included and bulk data follows in-memory rules. Measured in background and cached until object is modified"))
+		  .SortMode_Static(&ThisClass::GetColumnSortMode, Column_ID_SerializedSize)
+		  .OnSort(this, &ThisClass::OnColumnSortModeChanged)
+		  .FillWidth(0.1)
+		  .HAlignCell(HAlign_Right)
+		  .HAlignHeader(HAlign_Right)
+
+		+ SHeaderRow::Column(Column_ID_TextureResident)
+		  .DefaultLabel(INVTEXT("Resident"))
+		  .DefaultTooltip(INVTEXT("Memory of currently resident mips"))
+		  .SortMode_Static(&ThisClass::GetColumnSortMode, Column_ID_TextureResident)
+		  .OnSort(this, &ThisClass::OnColumnSortModeChanged)
+		  .FillWidth(0.08)
+		  .HAlignCell(HAlign_Right)
+		  .HAlignHeader(HAlign_Right)
+
+		+ SHeaderRow::Column(Column_ID_TextureFullSize)
+		  .DefaultLabel(INVTEXT("All Mips"))
+		  .DefaultTooltip(INVTEXT("Memory with all mips resident"))
+		  .SortMode_Static(&ThisClass::GetColumnSortMode, Column_ID_TextureFullSize)
+		  .OnSort(this, &ThisClass::OnColumnSortModeChanged)
+		  .FillWidth(0.08)
+		  .HAlignCell(HAlign_Right)
+		  .HAlignHeader(HAlign_Right)
+
+		+ SHeaderRow::Column(Column_ID_TextureMips)
+		  .DefaultLabel(INVTEXT("Mips"))
+		  .DefaultTooltip(INVTEXT("Resident / total mips"))
+		  .SortMode_Static(&ThisClass::GetColumnSortMode, Column_ID_TextureMips)
+		  .OnSort(this, &ThisClass::OnColumnSortModeChanged)
+		  .FillWidth(0.05)
+		  .HAlignCell(HAlign_Right)
+		  .HAlignHeader(HAlign_Right)
+
+		+ SHeaderRow::Column(Column_ID_TextureLODGroup)
+		  .DefaultLabel(INVTEXT("LOD Group"))
+		  .SortMode_Static(&ThisClass::GetColumnSortMode, Column_ID_TextureLODGroup)
+		  .OnSort(this, &ThisClass::OnColumnSortModeChanged)
+		  .FillWidth(0.1)
+
+		+ SHeaderRow::Column(Column_ID_TextureCompression)
+		  .DefaultLabel(INVTEXT("Compression"))
+		  .SortMode_Static(&ThisClass::GetColumnSortMode, Column_ID_TextureCompression)
+		  .OnSort(this, &ThisClass::OnColumnSortModeChanged)
+		  .FillWidth(0.1)
+
+		+ SHeaderRow::Column(Column_ID_TextureSource)
+		  .DefaultLabel(INVTEXT("Source"))
+		  .DefaultTooltip(INVTEXT("Source image dimensions"))
+		  .SortMode_Static(&ThisClass::GetColumnSortMode, Column_ID_TextureSource)
+		  .OnSort(this, &ThisClass::OnColumnSortModeChanged)
+		  .FillWidth(0.07)
+		  .HAlignCell(HAlign_Right)
+		  .HAlignHeader(HAlign_Right)
+
+		+ SHeaderRow::Column(Column_ID_TextureStreaming)
+		  .DefaultLabel(INVTEXT("Streaming"))
+		  .SortMode_Static(&ThisClass::GetColumnSortMode, Column_ID_TextureStreaming)
+		  .OnSort(this, &ThisClass::OnColumnSortModeChanged)
+		  .FillWidth(0.08);
+
+	// Optional column, enabled from header context menu
+	HeaderRowWidget->SetShowGeneratedColumn(Column_ID_SerializedSize, false);
+	// Shown with Textures filter, see UpdateTextureColumnsVisibility
+	for (const FName ColumnId : {Column_ID_TextureResident, Column_ID_TextureFullSize, Column_ID_TextureMips, Column_ID_TextureLODGroup, Column_ID_TextureCompression, Column_ID_TextureSource, Column_ID_TextureStreaming})
+	{
+		HeaderRowWidget->SetShowGeneratedColumn(ColumnId, false);
+	}
 
 	SAssignNew(TreeView, STreeView<FObjectOutlinerItemPtr>)
 	// UE_5.5 - deprecated slate attribute
 	//.ItemHeight(24.0f)
 	.TreeItemsSource(&Model->GetRootContent())
-	.SelectionMode(ESelectionMode::Single)
+	.SelectionMode(ESelectionMode::Multi)
 	.OnGenerateRow(this, &SObjectOutliner::HandleListGenerateRow)
 	// Called to child items for any given parent item
 	.OnGetChildren_Static(&SObjectOutliner::OnGetChildrenForOutlinerTree)
@@ -548,7 +1381,7 @@ TSharedRef<SWidget> SObjectOutliner::MakeTreeView()
 
 void SObjectOutliner::OnGetChildrenForOutlinerTree(const FObjectOutlinerItemPtr InParent, TArray<FObjectOutlinerItemPtr>& OutChildren)
 {
-	if (static_cast<EDisplayMode>(SettingsClass::Get().DisplayMode) != EDisplayMode::Tree)
+	if (IsTreeViewMode() == false)
 	{
 		return;
 	}
@@ -625,8 +1458,61 @@ FReply SObjectOutliner::OnRefreshClicked() const
 	return FReply::Handled();
 }
 
+FReply SObjectOutliner::OnExportClicked()
+{
+	FString Filename;
+	EObjectOutlinerExportFormat Format;
+	if (FObjectOutlinerExporter::PickExportFilename(AsShared(), Filename, Format))
+	{
+		// Snapshot is just weak pointers, all formatting happens on the worker
+		TArray<TWeakObjectPtr<UObject>> Objects;
+		Objects.Reserve(Model->GetDisplayedNum());
+		GatherDisplayedObjects(Model->GetRootContent(), Objects);
+
+		FObjectOutlinerExporter::ExportAsync(MoveTemp(Objects), Filename, Format);
+	}
+	return FReply::Handled();
+}
+
+void SObjectOutliner::GatherDisplayedObjects(const TArray<FObjectOutlinerItemPtr>& Items, TArray<TWeakObjectPtr<UObject>>& OutObjects)
+{
+	for (const FObjectOutlinerItemPtr& Item : Items)
+	{
+		if (Item->bIsGroupNode == false && Item->bIsExplicitlyAdded)
+		{
+			OutObjects.Add(Item->ObjectPtr);
+		}
+
+		if (IsTreeViewMode() && Item->GetChildren().Num() > 0)
+		{
+			TArray<FObjectOutlinerItemPtr> SortedChildren = Item->GetChildren().Array();
+			SortItems(SortedChildren);
+			GatherDisplayedObjects(SortedChildren, OutObjects);
+		}
+	}
+}
+
 
 FText SObjectOutliner::GetFilterStatusText() const
+{
+	if (bPopulatePending)
+	{
+		return INVTEXT("Scanning...");
+	}
+
+	FText Result = GetFilterCountsText();
+	if (Model->GetTopNBySize() > 0)
+	{
+		Result = FText::Format(INVTEXT("[Top {0} by size] {1}"), FText::AsNumber(Model->GetTopNBySize()), Result);
+	}
+	if (const TSharedPtr<const FObjectOutlinerPropertyQuery>& Query = Model->GetPropertyQuery())
+	{
+		Result = FText::Format(INVTEXT("[{0}] {1}"), Query->GetDescription(), Result);
+	}
+	return Result;
+}
+
+FText SObjectOutliner::GetFilterCountsText() const
 {
 	if (IsTextFilterActive() == false)
 	{
@@ -652,7 +1538,7 @@ FText SObjectOutliner::GetFilterStatusText() const
 
 FSlateColor SObjectOutliner::GetFilterStatusTextColor() const
 {
-	if (IsTextFilterActive() == false)
+	if (bPopulatePending || IsTextFilterActive() == false)
 	{
 		return FSlateColor::UseForeground();
 	}
@@ -693,6 +1579,55 @@ void SObjectOutliner::SortItems(TArray<FObjectOutlinerItemPtr>& Items)
 		{
 			if (A.IsValid() && B.IsValid())
 			{
+				// Class and package nodes go before instances, ordered by rolled up values
+				if (A->bIsGroupNode != B->bIsGroupNode)
+				{
+					return A->bIsGroupNode;
+				}
+				if (A->bIsGroupNode && SortColumnID != Column_ID_Name)
+				{
+					const FObjectOutlinerItem& Ga = SortColumnMode == EColumnSortMode::Ascending ? *A : *B;
+					const FObjectOutlinerItem& Gb = SortColumnMode == EColumnSortMode::Ascending ? *B : *A;
+					return SortColumnID == Column_ID_Memory ? Ga.GroupedMemory < Gb.GroupedMemory : Ga.GroupedNum < Gb.GroupedNum;
+				}
+
+				if (IsTextureColumn(SortColumnID))
+				{
+					// Values gathered once per item, non texture items are treated as smallest
+					const FObjectOutlinerTextureInfo* Ta = (SortColumnMode == EColumnSortMode::Ascending) ? A->GetTextureInfo() : B->GetTextureInfo();
+					const FObjectOutlinerTextureInfo* Tb = (SortColumnMode == EColumnSortMode::Ascending) ? B->GetTextureInfo() : A->GetTextureInfo();
+					if (Ta == nullptr || Tb == nullptr)
+					{
+						return Ta == nullptr && Tb != nullptr;
+					}
+					if (SortColumnID == Column_ID_TextureResident)
+					{
+						return Ta->ResidentSize < Tb->ResidentSize;
+					}
+					if (SortColumnID == Column_ID_TextureFullSize)
+					{
+						return Ta->FullSize < Tb->FullSize;
+					}
+					if (SortColumnID == Column_ID_TextureMips)
+					{
+						return Ta->ResidentMips != Tb->ResidentMips ? Ta->ResidentMips < Tb->ResidentMips : Ta->TotalMips < Tb->TotalMips;
+					}
+					if (SortColumnID == Column_ID_TextureLODGroup)
+					{
+						return Ta->LODGroup.CompareTo(Tb->LODGroup) < 0;
+					}
+					if (SortColumnID == Column_ID_TextureCompression)
+					{
+						return Ta->Compression.CompareTo(Tb->Compression) < 0;
+					}
+					if (SortColumnID == Column_ID_TextureSource)
+					{
+						return static_cast<int64>(Ta->SourceSize.X) * Ta->SourceSize.Y < static_cast<int64>(Tb->SourceSize.X) * Tb->SourceSize.Y;
+					}
+					// Never stream first in descending order, these are the ones to look at
+					return Ta->bNeverStream != Tb->bNeverStream ? Tb->bNeverStream : Ta->bStreamable < Tb->bStreamable;
+				}
+
 				const auto Aa = (SortColumnMode == EColumnSortMode::Ascending) ? A->ObjectPtr.Get() : B->ObjectPtr.Get();
 				const auto Bb = (SortColumnMode == EColumnSortMode::Ascending) ? B->ObjectPtr.Get() : A->ObjectPtr.Get();
 
@@ -708,7 +1643,14 @@ void SObjectOutliner::SortItems(TArray<FObjectOutlinerItemPtr>& Items)
 					}
 					if (SortColumnID == Column_ID_Memory)
 					{
-						return Aa->GetResourceSizeBytes(EResourceSizeMode::Exclusive) < Bb->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+						// Each item queries resource size once, not on every comparison
+						return (SortColumnMode == EColumnSortMode::Ascending) ? A->GetMemory() < B->GetMemory() : B->GetMemory() < A->GetMemory();
+					}
+					if (SortColumnID == Column_ID_SerializedSize)
+					{
+						// Cached values only, not measured objects are treated as smallest
+						const FObjectOutlinerSerializedSizeCache& SizeCache = FObjectOutlinerSerializedSizeCache::Get();
+						return SizeCache.Find(Aa) < SizeCache.Find(Bb);
 					}
 				}
 			}
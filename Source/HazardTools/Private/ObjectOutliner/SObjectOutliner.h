@@ -26,18 +26,43 @@ public:
 
 	/** @return Returns a string to use for highlighting results in the outliner list */
 	TAttribute<FText> GetTextFilterHighlightText() const;
+	// Tree or class tree
 	static bool IsTreeViewMode();
+	static EDisplayMode GetDisplayMode();
 
 	static const FName Column_ID_Name;
 	static const FName Column_ID_Class;
 	static const FName Column_ID_Memory;
+	static const FName Column_ID_SerializedSize;
+
+	// Shown while Textures filter is enabled
+	static const FName Column_ID_TextureResident;
+	static const FName Column_ID_TextureFullSize;
+	static const FName Column_ID_TextureMips;
+	static const FName Column_ID_TextureLODGroup;
+	static const FName Column_ID_TextureCompression;
+	static const FName Column_ID_TextureSource;
+	static const FName Column_ID_TextureStreaming;
+	static bool IsTextureColumn(FName ColumnId);
 
 private:
 	TSharedRef<SHorizontalBox> MakeToolbar();
 	TSharedRef<SWidget> MakeTreeView();
+	TSharedRef<SWidget> MakeTimelineArea();
+	TSharedRef<SWidget> MakePropertySearchRow();
+	TSharedRef<SWidget> GetPropertySearchMenuContent();
+	FText GetPropertySearchPropertyText() const;
 	TSharedRef<::IDetailsView> MakePropertyEditor();
 	TSharedRef<SHorizontalBox> MakeImperativeFilterButtons();
 	TSharedRef<SWidget> GetDropDownFiltersButtonContent();
+	TSharedRef<SWidget> GetWorldScopeMenuContent();
+	TSharedRef<SWidget> GetAnalyzeMenuContent();
+	// Run analysis on explicitly matched objects currently displayed, outer rows shown only for hierarchy are left out.
+	// Report windows bind it with CreateSP, so it is never called once outliner is gone and refresh does nothing then
+	TSharedPtr<FObjectOutlinerReport> RunAnalysis(TSharedPtr<FObjectOutlinerAnalysis> Analysis) const;
+	bool IsDropDownFilterEnabled(FName FilterName) const;
+	FText GetWorldScopeText() const;
+	static FText GetWorldDisplayText(const UWorld* World);
 	void HandleToggleAllDropDownFilters();
 
 	TSharedRef<ITableRow> HandleListGenerateRow(FObjectOutlinerItemPtr ObjectPtr, const TSharedRef<STableViewBase>& OwnerTable);
@@ -46,7 +71,15 @@ private:
 
 	void Populate() const;
 
-	void HandleListSelectionChanged(FObjectOutlinerItemPtr InItem, ESelectInfo::Type SelectInfo) const;
+	// First population waits until the tab is painted (active timers only tick for visible widgets) and editor is idle
+	EActiveTimerReturnType HandleDeferredPopulate(double InCurrentTime, float InDeltaTime);
+
+	void HandleListSelectionChanged(FObjectOutlinerItemPtr InItem, ESelectInfo::Type SelectInfo);
+	// Build details view for the last selected object once selection stops changing
+	EActiveTimerReturnType HandleDetailsDebounce(double InCurrentTime, float InDeltaTime);
+	void CancelDetailsDebounce();
+	// Select item clicked in treemap, expanding its parents
+	void SelectItem(FObjectOutlinerItemPtr Item) const;
 
 	static void OnGetChildrenForOutlinerTree(FObjectOutlinerItemPtr InParent, TArray<FObjectOutlinerItemPtr>& OutChildren);
 
@@ -61,8 +94,24 @@ private:
 
 	FReply OnRefreshClicked() const;
 
+	// Queue serialized size measurement of all displayed objects if the column is visible
+	void RequestSerializedSizes() const;
+	// Show texture columns when Textures filter gets enabled, hide them when it gets disabled
+	void UpdateTextureColumnsVisibility() const;
+	FReply OnExportClicked();
+	FReply OnSaveTimelineClicked() const;
+	FReply OnPropertySearchClicked();
+	FReply OnPropertySearchClearClicked();
+
+	/**
+	 * Collects objects of explicitly matched items (tree mode include nested items, collapsed or not) in the same order as they are displayed.
+	 * Outer rows added in tree mode only to show hierarchy and group nodes are skipped, they didn't pass the filters.
+	 */
+	static void GatherDisplayedObjects(const TArray<FObjectOutlinerItemPtr>& Items, TArray<TWeakObjectPtr<UObject>>& OutObjects);
+
 	/** @return	Returns the filter status text */
 	FText GetFilterStatusText() const;
+	FText GetFilterCountsText() const;
 
 	/** @return Returns color for the filter status text message, based on success of search filter */
 	FSlateColor GetFilterStatusTextColor() const;
@@ -85,14 +134,27 @@ private:
 	TSharedPtr<SHeaderRow> HeaderRowWidget; // The header row of the scene outliner
 	TSharedPtr<STreeView<FObjectOutlinerItemPtr>> TreeView;
 	TSharedPtr<::IDetailsView> PropertyEditor;
+	TSharedPtr<SObjectOutlinerTreemap> Treemap;
+	TSharedPtr<SObjectOutlinerInspector> Inspector;
+	TWeakObjectPtr<UObject> InspectedObject;
+	TSharedPtr<FActiveTimerHandle> DetailsDebounceTimerHandle;
 	TSharedPtr<SSearchBox> FilterTextBoxWidget;      // Widget containing the filtering text box
 	TSharedPtr<SComboButton> ViewOptionsComboButton; // The button that displays view options
 
 	TArray<TSharedPtr<FObjectOutlinerFilter>> ImperativeFilters;
 	TArray<TSharedPtr<FObjectOutlinerFilter>> DropDownFilters;
+	TArray<TSharedPtr<FObjectOutlinerAnalysis>> Analyses;
 	//bool bShowOnlyCheckedObjects = false;
 	TSharedPtr<TTextFilter<const UObject&>> SearchBoxFilter;
 
 	TSharedPtr<FObjectOutlinerModel> Model;
+	mutable bool bTextureColumnsVisible = false;
+	bool bPopulatePending = true;
+
+	// Property value search
+	bool bPropertySearchVisible = false;
+	TWeakObjectPtr<UClass> PropertySearchClass;
+	FName PropertySearchPropertyName;
+	TSharedPtr<SEditableTextBox> PropertySearchValueBox;
 };
 };
@@ -0,0 +1,398 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "SObjectOutlinerInspector.h"
+
+#include "HazardToolsUtils.h"
+
+namespace HazardTools
+{
+namespace Inspector
+{
+// Bigger containers end with a "N more" row, the tree is virtualized but row objects are not
+constexpr int32 MaxContainerElementsNum = 10000;
+}
+
+enum class EObjectOutlinerInspectorRowKind : uint8
+{
+	Member,
+	ArrayElement,
+	SetElement,
+	// Key and value are member rows of the pair
+	MapPair,
+};
+
+struct FObjectOutlinerInspectorRow
+{
+	TWeakPtr<FObjectOutlinerInspectorRow> Parent;
+	// Member property, inner property for array and set elements, map property for map pairs
+	const FProperty* Property = nullptr;
+	// Static array index of member, element index in parent array, or sparse index in parent set or map
+	int32 Index = 0;
+	EObjectOutlinerInspectorRowKind Kind = EObjectOutlinerInspectorRowKind::Member;
+
+	FString Name;
+	FString Type;
+	// Text shown instead of a value, e.g. for truncated arrays
+	FString Placeholder;
+
+	TArray<FObjectOutlinerInspectorRowPtr> Children;
+	bool bChildrenCreated = false;
+
+	[[nodiscard]] bool HasChildren() const
+	{
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			return FHazardToolsUtils::IsPropertyBuiltinStruct(StructProperty) == false;
+		}
+		return Property != nullptr && (Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>() || Property->IsA<FMapProperty>());
+	}
+};
+
+namespace Inspector
+{
+class SRow : public SMultiColumnTableRow<FObjectOutlinerInspectorRowPtr>
+{
+public:
+	SLATE_BEGIN_ARGS(SRow)
+		{
+		}
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& /*InArgs*/, const TSharedRef<STableViewBase>& InOwnerTableView, const FObjectOutlinerInspectorRowPtr& InRow, const TSharedRef<SObjectOutlinerInspector>& InInspector)
+	{
+		Row = InRow;
+		ValueText = FText::FromString(FormatValue(*InRow, *InInspector));
+		SMultiColumnTableRow<FObjectOutlinerInspectorRowPtr>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+	{
+		if (ColumnName == SObjectOutlinerInspector::Column_ID_Name)
+		{
+			return SNew(SHorizontalBox)
+
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				[
+					SNew(SExpanderArrow, SharedThis(this))
+					.IndentAmount(12)
+				]
+
+				+ SHorizontalBox::Slot()
+				.FillWidth(1.f)
+				.VAlign(VAlign_Center)
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(Row->Name))
+				];
+		}
+
+		if (ColumnName == SObjectOutlinerInspector::Column_ID_Value)
+		{
+			return SNew(STextBlock)
+				.Text(ValueText)
+				.ToolTipText(ValueText);
+		}
+
+		return SNew(STextBlock)
+			.Text(FText::FromString(Row->Type))
+			.ColorAndOpacity(FSlateColor::UseSubduedForeground());
+	}
+
+private:
+	static FString FormatValue(const FObjectOutlinerInspectorRow& Row, const SObjectOutlinerInspector& Inspector)
+	{
+		if (Row.Placeholder.IsEmpty() == false)
+		{
+			return Row.Placeholder;
+		}
+
+		const void* Value = Inspector.ResolveValue(Row);
+		if (Value == nullptr)
+		{
+			return TEXT("<invalid>");
+		}
+
+		if (Row.Kind == EObjectOutlinerInspectorRowKind::MapPair)
+		{
+			// Value is listed in children, key alone identifies the pair
+			const FProperty* KeyProperty = CastFieldChecked<FMapProperty>(Row.Property)->KeyProp;
+			const FStructProperty* KeyStructProperty = CastField<FStructProperty>(KeyProperty);
+			return KeyStructProperty == nullptr || FHazardToolsUtils::IsPropertyBuiltinStruct(KeyStructProperty) ? FHazardToolsUtils::PropertyValueToString(KeyProperty, Value) : FString();
+		}
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Row.Property))
+		{
+			return FString::Printf(TEXT("%d elements"), FScriptArrayHelper(ArrayProperty, Value).Num());
+		}
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(Row.Property))
+		{
+			return FString::Printf(TEXT("%d elements"), FScriptSetHelper(SetProperty, Value).Num());
+		}
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(Row.Property))
+		{
+			return FString::Printf(TEXT("%d elements"), FScriptMapHelper(MapProperty, Value).Num());
+		}
+		if (Row.HasChildren())
+		{
+			return FString();
+		}
+		return FHazardToolsUtils::PropertyValueToString(Row.Property, Value);
+	}
+
+	FObjectOutlinerInspectorRowPtr Row;
+	FText ValueText;
+};
+}
+
+const FName SObjectOutlinerInspector::Column_ID_Name = "Name";
+const FName SObjectOutlinerInspector::Column_ID_Value = "Value";
+const FName SObjectOutlinerInspector::Column_ID_Type = "Type";
+
+void SObjectOutlinerInspector::Construct(const FArguments& InArgs)
+{
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.f)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(this, &ThisClass::GetObjectNameText)
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+				.ToolTipText(INVTEXT("Read values again"))
+				.OnClicked(this, &ThisClass::OnRefreshClicked)
+				[
+					SNew(SImage)
+					.ColorAndOpacity(FSlateColor::UseForeground())
+					.Image(FAppStyle::Get().GetBrush("Icons.Refresh"))
+				]
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SAssignNew(TreeView, STreeView<FObjectOutlinerInspectorRowPtr>)
+			.TreeItemsSource(&RootRows)
+			.SelectionMode(ESelectionMode::Single)
+			.OnGenerateRow(this, &ThisClass::HandleGenerateRow)
+			.OnGetChildren(this, &ThisClass::HandleGetChildren)
+			.HeaderRow
+			(
+				SNew(SHeaderRow)
+
+				+ SHeaderRow::Column(Column_ID_Name)
+				.DefaultLabel(INVTEXT("Name"))
+				.FillWidth(0.35f)
+
+				+ SHeaderRow::Column(Column_ID_Value)
+				.DefaultLabel(INVTEXT("Value"))
+				.FillWidth(0.45f)
+
+				+ SHeaderRow::Column(Column_ID_Type)
+				.DefaultLabel(INVTEXT("Type"))
+				.FillWidth(0.2f)
+			)
+		]
+	];
+}
+
+void SObjectOutlinerInspector::SetObject(UObject* InObject)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(SObjectOutlinerInspector::SetObject);
+
+	Object = InObject;
+	ObjectClass = InObject != nullptr ? InObject->GetClass() : nullptr;
+	RootRows.Reset();
+	if (InObject != nullptr)
+	{
+		AddPropertyRows(InObject->GetClass(), nullptr, RootRows);
+	}
+	TreeView->RequestTreeRefresh();
+}
+
+void SObjectOutlinerInspector::AddPropertyRows(const UStruct* Struct, const FObjectOutlinerInspectorRowPtr& Parent, TArray<FObjectOutlinerInspectorRowPtr>& OutRows) const
+{
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		const FProperty* Property = *It;
+		for (int32 ArrayIndex = 0; ArrayIndex < Property->GetArrayDim(); ++ArrayIndex)
+		{
+			const FObjectOutlinerInspectorRowPtr Row = MakeShared<FObjectOutlinerInspectorRow>();
+			Row->Parent = Parent;
+			Row->Property = Property;
+			Row->Index = ArrayIndex;
+			Row->Name = Property->GetArrayDim() > 1 ? FString::Printf(TEXT("%s[%d]"), *Property->GetName(), ArrayIndex) : Property->GetName();
+			Row->Type = FHazardToolsUtils::GetPropertyTypeName(Property);
+			OutRows.Add(Row);
+		}
+	}
+}
+
+const void* SObjectOutlinerInspector::ResolveValue(const FObjectOutlinerInspectorRow& Row) const
+{
+	const FObjectOutlinerInspectorRowPtr Parent = Row.Parent.Pin();
+	if (Parent.IsValid() == false)
+	{
+		const UObject* Container = Object.Get();
+		// Rows point to properties of the class they were made from, blueprint recompile may give the object a new class
+		return Container != nullptr && Container->GetClass() == ObjectClass.Get() ? Row.Property->ContainerPtrToValuePtr<void>(Container, Row.Index) : nullptr;
+	}
+
+	const void* ParentValue = ResolveValue(*Parent);
+	if (ParentValue == nullptr)
+	{
+		return nullptr;
+	}
+
+	switch (Row.Kind)
+	{
+	case EObjectOutlinerInspectorRowKind::ArrayElement:
+		{
+			FScriptArrayHelper ArrayHelper(CastFieldChecked<FArrayProperty>(Parent->Property), ParentValue);
+			return ArrayHelper.IsValidIndex(Row.Index) ? ArrayHelper.GetRawPtr(Row.Index) : nullptr;
+		}
+	case EObjectOutlinerInspectorRowKind::SetElement:
+		{
+			FScriptSetHelper SetHelper(CastFieldChecked<FSetProperty>(Parent->Property), ParentValue);
+			return SetHelper.IsValidIndex(Row.Index) ? SetHelper.GetElementPtr(Row.Index) : nullptr;
+		}
+	case EObjectOutlinerInspectorRowKind::MapPair:
+		{
+			FScriptMapHelper MapHelper(CastFieldChecked<FMapProperty>(Parent->Property), ParentValue);
+			return MapHelper.IsValidIndex(Row.Index) ? MapHelper.GetPairPtr(Row.Index) : nullptr;
+		}
+	default:
+		// Struct members, and key or value of a map pair, both live at property offset
+		return Row.Property->ContainerPtrToValuePtr<void>(ParentValue, Row.Index);
+	}
+}
+
+TSharedRef<ITableRow> SObjectOutlinerInspector::HandleGenerateRow(const FObjectOutlinerInspectorRowPtr Row, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(Inspector::SRow, OwnerTable, Row, SharedThis(this));
+}
+
+void SObjectOutlinerInspector::HandleGetChildren(const FObjectOutlinerInspectorRowPtr Row, TArray<FObjectOutlinerInspectorRowPtr>& OutChildren)
+{
+	if (Row->HasChildren() == false)
+	{
+		return;
+	}
+
+	// Tree asks for children of every visible row to draw expander arrow, so only create them once
+	if (Row->bChildrenCreated == false)
+	{
+		Row->bChildrenCreated = true;
+
+		if (Row->Kind == EObjectOutlinerInspectorRowKind::MapPair)
+		{
+			const FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(Row->Property);
+			for (const FProperty* PairProperty : {MapProperty->KeyProp, MapProperty->ValueProp})
+			{
+				const FObjectOutlinerInspectorRowPtr Member = MakeShared<FObjectOutlinerInspectorRow>();
+				Member->Parent = Row;
+				Member->Property = PairProperty;
+				Member->Name = PairProperty == MapProperty->KeyProp ? TEXT("Key") : TEXT("Value");
+				Member->Type = FHazardToolsUtils::GetPropertyTypeName(PairProperty);
+				Row->Children.Add(Member);
+			}
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Row->Property))
+		{
+			AddPropertyRows(StructProperty->Struct, Row, Row->Children);
+		}
+		else if (const void* Value = ResolveValue(*Row))
+		{
+			AddElementRows(Row, Value);
+		}
+	}
+	OutChildren = Row->Children;
+}
+
+void SObjectOutlinerInspector::AddElementRows(const FObjectOutlinerInspectorRowPtr& Row, const void* Value) const
+{
+	int32 ElementsNum = 0;
+	const auto AddElement = [&Row, &ElementsNum](const FProperty* Property, const int32 Index, const EObjectOutlinerInspectorRowKind Kind, const FString& Type)
+	{
+		const FObjectOutlinerInspectorRowPtr Element = MakeShared<FObjectOutlinerInspectorRow>();
+		Element->Parent = Row;
+		Element->Property = Property;
+		Element->Index = Index;
+		Element->Kind = Kind;
+		// Set and map indices are sparse, name by position instead
+		Element->Name = FString::Printf(TEXT("[%d]"), ElementsNum++);
+		Element->Type = Type;
+		Row->Children.Add(Element);
+	};
+
+	int32 TotalNum = 0;
+	if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Row->Property))
+	{
+		TotalNum = FScriptArrayHelper(ArrayProperty, Value).Num();
+		const FString InnerType = FHazardToolsUtils::GetPropertyTypeName(ArrayProperty->Inner);
+		for (int32 Index = 0; Index < FMath::Min(TotalNum, Inspector::MaxContainerElementsNum); ++Index)
+		{
+			AddElement(ArrayProperty->Inner, Index, EObjectOutlinerInspectorRowKind::ArrayElement, InnerType);
+		}
+	}
+	else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Row->Property))
+	{
+		const FScriptSetHelper SetHelper(SetProperty, Value);
+		TotalNum = SetHelper.Num();
+		const FString ElementType = FHazardToolsUtils::GetPropertyTypeName(SetProperty->ElementProp);
+		for (FScriptSetHelper::FIterator It(SetHelper); It && ElementsNum < Inspector::MaxContainerElementsNum; ++It)
+		{
+			AddElement(SetProperty->ElementProp, It.GetInternalIndex(), EObjectOutlinerInspectorRowKind::SetElement, ElementType);
+		}
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Row->Property))
+	{
+		const FScriptMapHelper MapHelper(MapProperty, Value);
+		TotalNum = MapHelper.Num();
+		const FString PairType = FString::Printf(TEXT("%s, %s"), *FHazardToolsUtils::GetPropertyTypeName(MapProperty->KeyProp), *FHazardToolsUtils::GetPropertyTypeName(MapProperty->ValueProp));
+		for (FScriptMapHelper::FIterator It(MapHelper); It && ElementsNum < Inspector::MaxContainerElementsNum; ++It)
+		{
+			AddElement(MapProperty, It.GetInternalIndex(), EObjectOutlinerInspectorRowKind::MapPair, PairType);
+		}
+	}
+
+	if (TotalNum > Inspector::MaxContainerElementsNum)
+	{
+		const FObjectOutlinerInspectorRowPtr More = MakeShared<FObjectOutlinerInspectorRow>();
+		More->Parent = Row;
+		More->Name = TEXT("...");
+		More->Placeholder = FString::Printf(TEXT("%d more elements"), TotalNum - Inspector::MaxContainerElementsNum);
+		Row->Children.Add(More);
+	}
+}
+
+FText SObjectOutlinerInspector::GetObjectNameText() const
+{
+	const UObject* Container = Object.Get();
+	return Container != nullptr ? FText::FromString(Container->GetFullName()) : INVTEXT("No object selected");
+}
+
+FReply SObjectOutlinerInspector::OnRefreshClicked()
+{
+	// Rows are rebuilt from scratch, expanded state is not kept
+	SetObject(Object.Get());
+	return FReply::Handled();
+}
+}
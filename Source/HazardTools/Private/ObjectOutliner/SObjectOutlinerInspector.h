@@ -0,0 +1,58 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/STreeView.h"
+
+namespace HazardTools
+{
+struct FObjectOutlinerInspectorRow;
+using FObjectOutlinerInspectorRowPtr = TSharedPtr<FObjectOutlinerInspectorRow>;
+
+/**
+ * Read only alternative to IDetailsView: reflected properties of one object in a virtualized tree.
+ * Setting an object only creates top level rows, values are formatted when a row scrolls into view
+ * and struct members or array, set and map elements are created when their parent is expanded.
+ * Value text is read once when its row is generated and is not live, refresh button rebuilds rows to read current values.
+ * Rows keep property and index path instead of memory address, so a stale row never reads freed container memory.
+ */
+class SObjectOutlinerInspector : public SCompoundWidget
+{
+	using ThisClass = SObjectOutlinerInspector;
+public:
+	SLATE_BEGIN_ARGS(SObjectOutlinerInspector)
+		{
+		}
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	void SetObject(UObject* InObject);
+
+	static const FName Column_ID_Name;
+	static const FName Column_ID_Value;
+	static const FName Column_ID_Type;
+
+	// Null if the object is gone or changed class, or container element does not exist anymore
+	[[nodiscard]] const void* ResolveValue(const FObjectOutlinerInspectorRow& Row) const;
+
+private:
+	void AddPropertyRows(const UStruct* Struct, const FObjectOutlinerInspectorRowPtr& Parent, TArray<FObjectOutlinerInspectorRowPtr>& OutRows) const;
+	// Array, set and map elements of an expanded row, map pairs get key and value rows when expanded
+	void AddElementRows(const FObjectOutlinerInspectorRowPtr& Row, const void* Value) const;
+
+	TSharedRef<ITableRow> HandleGenerateRow(FObjectOutlinerInspectorRowPtr Row, const TSharedRef<STableViewBase>& OwnerTable);
+	void HandleGetChildren(FObjectOutlinerInspectorRowPtr Row, TArray<FObjectOutlinerInspectorRowPtr>& OutChildren);
+	FText GetObjectNameText() const;
+	FReply OnRefreshClicked();
+
+	TWeakObjectPtr<UObject> Object;
+	// Class the rows were made from
+	TWeakObjectPtr<const UClass> ObjectClass;
+	TArray<FObjectOutlinerInspectorRowPtr> RootRows;
+	TSharedPtr<STreeView<FObjectOutlinerInspectorRowPtr>> TreeView;
+};
+}
@@ -0,0 +1,380 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "SObjectOutlinerReport.h"
+
+#include "AssetViewUtils.h"
+#include "Algo/Compare.h"
+#include "DesktopPlatformModule.h"
+#include "IDesktopPlatform.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+namespace HazardTools
+{
+namespace ReportView
+{
+	class SRow : public SMultiColumnTableRow<FObjectOutlinerReportRowPtr>
+	{
+	public:
+		SLATE_BEGIN_ARGS(SRow)
+			{
+			}
+
+		SLATE_END_ARGS()
+
+		void Construct(const FArguments& /*InArgs*/, const TSharedRef<STableViewBase>& InOwnerTableView, const FObjectOutlinerReportRowPtr& InRow, const TSharedRef<FObjectOutlinerReport>& InReport)
+		{
+			Row = InRow;
+			Report = InReport;
+
+			if (Row->Tooltip.IsEmpty() == false)
+			{
+				SetToolTipText(FText::FromString(Row->Tooltip));
+			}
+
+			SMultiColumnTableRow<FObjectOutlinerReportRowPtr>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+		}
+
+		virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+		{
+			const int32 ColumnIndex = Report->Columns.IndexOfByPredicate([ColumnName](const FObjectOutlinerReportColumn& Column) { return Column.Id == ColumnName; });
+			if (ColumnIndex == INDEX_NONE)
+			{
+				return SNullWidget::NullWidget;
+			}
+
+			static FSlateColor ColorAccentOrange = FAppStyle::Get().GetSlateColor("Colors.AccentOrange");
+			const FSlateColor ContentColor = Row->bHighlight ? ColorAccentOrange : FSlateColor::UseForeground();
+
+			const TSharedRef<STextBlock> TextBlock = SNew(STextBlock)
+				.Text(FObjectOutlinerReport::FormatCell(Report->Columns[ColumnIndex], Row->Cells[ColumnIndex]))
+				.ColorAndOpacity(ContentColor);
+
+			if (ColumnIndex == 0)
+			{
+				return SNew(SHorizontalBox)
+
+					+ SHorizontalBox::Slot()
+					.AutoWidth()
+					[
+						SNew(SExpanderArrow, SharedThis(this))
+						.IndentAmount(12)
+					]
+
+					+ SHorizontalBox::Slot()
+					.FillWidth(1.f)
+					.VAlign(VAlign_Center)
+					[
+						TextBlock
+					];
+			}
+			return TextBlock;
+		}
+
+	private:
+		FObjectOutlinerReportRowPtr Row;
+		TSharedPtr<FObjectOutlinerReport> Report;
+	};
+}
+
+void SObjectOutlinerReport::Construct(const FArguments& InArgs)
+{
+	Generator = InArgs._Generator;
+	AutoRefreshInterval = FMath::Max(0.1f, InArgs._AutoRefreshInterval);
+
+	const TSharedRef<SHorizontalBox> Toolbar = SNew(SHorizontalBox)
+
+		+ SHorizontalBox::Slot()
+		.FillWidth(1.f)
+		.VAlign(VAlign_Center)
+		[
+			SNew(STextBlock)
+			.AutoWrapText(true)
+			.Text_Lambda([&]() { return Report.IsValid() ? Report->Summary : FText::GetEmpty(); })
+		];
+
+	if (Generator.IsBound())
+	{
+		Toolbar->AddSlot()
+		       .AutoWidth()
+		       .VAlign(VAlign_Center)
+		       .Padding(4.f, 0.f, 0.f, 0.f)
+		[
+			SNew(SCheckBox)
+			.ToolTipText(FText::Format(INVTEXT("Regenerate report every {0} seconds"), FText::AsNumber(AutoRefreshInterval)))
+			.IsChecked_Lambda([&]() { return AutoRefreshTimerHandle.IsValid() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+			.OnCheckStateChanged_Lambda([&](const ECheckBoxState NewState)
+			{
+				if (NewState == ECheckBoxState::Checked && AutoRefreshTimerHandle.IsValid() == false)
+				{
+					AutoRefreshTimerHandle = RegisterActiveTimer(AutoRefreshInterval, FWidgetActiveTimerDelegate::CreateSP(this, &ThisClass::HandleAutoRefreshTimer));
+				}
+				else if (NewState != ECheckBoxState::Checked && AutoRefreshTimerHandle.IsValid())
+				{
+					UnRegisterActiveTimer(AutoRefreshTimerHandle.ToSharedRef());
+					AutoRefreshTimerHandle.Reset();
+				}
+			})
+			[
+				SNew(STextBlock)
+				.Text(INVTEXT("Auto Refresh"))
+			]
+		];
+
+		Toolbar->AddSlot()
+		       .AutoWidth()
+		       .VAlign(VAlign_Center)
+		       .Padding(4.f, 0.f, 0.f, 0.f)
+		[
+			SNew(SButton)
+			.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+			.ToolTipText(INVTEXT("Regenerate report"))
+			.OnClicked(this, &ThisClass::OnRefreshClicked)
+			[
+				SNew(SImage)
+				.ColorAndOpacity(FSlateColor::UseForeground())
+				.Image(FAppStyle::Get().GetBrush("Icons.Refresh"))
+			]
+		];
+	}
+
+	Toolbar->AddSlot()
+	       .AutoWidth()
+	       .VAlign(VAlign_Center)
+	       .Padding(4.f, 0.f, 0.f, 0.f)
+	[
+		SNew(SButton)
+		.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+		.ToolTipText(INVTEXT("Export report to CSV file"))
+		.OnClicked(this, &ThisClass::OnExportClicked)
+		[
+			SNew(SImage)
+			.ColorAndOpacity(FSlateColor::UseForeground())
+			.Image(FAppStyle::Get().GetBrush("Icons.Save"))
+		]
+	];
+
+	SAssignNew(HeaderRow, SHeaderRow);
+
+	ChildSlot
+	[
+		SNew(SBorder)
+		.Padding(FMargin(3))
+		.BorderImage(FAppStyle::Get().GetBrush("ToolPanel.GroupBorder"))
+		[
+			SNew(SVerticalBox)
+
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(8.f, 8.f, 8.f, 4.f)
+			[
+				Toolbar
+			]
+
+			+ SVerticalBox::Slot()
+			.FillHeight(1.f)
+			[
+				SAssignNew(TreeView, STreeView<FObjectOutlinerReportRowPtr>)
+				.SelectionMode(ESelectionMode::Multi)
+				.OnGenerateRow(this, &ThisClass::HandleGenerateRow)
+				.OnGetChildren_Static(&ThisClass::HandleGetChildren)
+				.OnMouseButtonDoubleClick(this, &ThisClass::HandleRowDoubleClick)
+				.HeaderRow(HeaderRow)
+			]
+		]
+	];
+
+	SetReport(InArgs._Report);
+}
+
+void SObjectOutlinerReport::OpenWindow(const TSharedRef<FObjectOutlinerReport>& Report, const FObjectOutlinerReportGenerator& Generator)
+{
+	const TSharedRef<SWindow> Window = SNew(SWindow)
+		.Title(Report->Title)
+		.ClientSize(FVector2D(1000.f, 640.f))
+		.SupportsMinimize(true)
+		.SupportsMaximize(true)
+		[
+			SNew(SObjectOutlinerReport)
+			.Report(Report)
+			.Generator(Generator)
+		];
+
+	if (const TSharedPtr<SWindow> RootWindow = FGlobalTabmanager::Get()->GetRootWindow())
+	{
+		FSlateApplication::Get().AddWindowAsNativeChild(Window, RootWindow.ToSharedRef());
+	}
+	else
+	{
+		FSlateApplication::Get().AddWindow(Window);
+	}
+}
+
+void SObjectOutlinerReport::SetReport(const TSharedPtr<FObjectOutlinerReport>& InReport)
+{
+	// Keep columns and sorting if regenerated report has the same layout
+	const bool bSameColumns = Report.IsValid() && InReport.IsValid() && Report->Columns.Num() == InReport->Columns.Num()
+	                          && Algo::CompareBy(Report->Columns, InReport->Columns, &FObjectOutlinerReportColumn::Id);
+	Report = InReport;
+
+	if (bSameColumns == false)
+	{
+		SortColumnId = NAME_None;
+		SortMode = EColumnSortMode::None;
+		RebuildHeaderRow();
+	}
+
+	static TArray<FObjectOutlinerReportRowPtr> EmptyRows;
+	if (Report.IsValid())
+	{
+		SortRows(Report->Rows);
+		TreeView->SetTreeItemsSource(&Report->Rows);
+	}
+	else
+	{
+		TreeView->SetTreeItemsSource(&EmptyRows);
+	}
+	TreeView->RequestTreeRefresh();
+}
+
+void SObjectOutlinerReport::RebuildHeaderRow()
+{
+	HeaderRow->ClearColumns();
+	if (Report.IsValid() == false)
+	{
+		return;
+	}
+
+	for (const FObjectOutlinerReportColumn& Column : Report->Columns)
+	{
+		const bool bNumeric = Column.Type != EObjectOutlinerReportColumnType::Text;
+		HeaderRow->AddColumn(
+			SHeaderRow::Column(Column.Id)
+			.DefaultLabel(Column.Label)
+			.FillWidth(Column.FillWidth)
+			.HAlignCell(bNumeric ? HAlign_Right : HAlign_Left)
+			.HAlignHeader(bNumeric ? HAlign_Right : HAlign_Left)
+			.SortMode(this, &ThisClass::GetColumnSortMode, Column.Id)
+			.OnSort(this, &ThisClass::OnColumnSortModeChanged));
+	}
+}
+
+void SObjectOutlinerReport::SortRows(TArray<FObjectOutlinerReportRowPtr>& InRows) const
+{
+	const int32 ColumnIndex = SortMode != EColumnSortMode::None
+		                          ? Report->Columns.IndexOfByPredicate([&](const FObjectOutlinerReportColumn& Column) { return Column.Id == SortColumnId; })
+		                          : INDEX_NONE;
+	if (ColumnIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const bool bAscending = SortMode == EColumnSortMode::Ascending;
+	const bool bText = Report->Columns[ColumnIndex].Type == EObjectOutlinerReportColumnType::Text;
+	InRows.StableSort([&](const FObjectOutlinerReportRowPtr& A, const FObjectOutlinerReportRowPtr& B)
+	{
+		const FObjectOutlinerReportCell& Aa = (bAscending ? A : B)->Cells[ColumnIndex];
+		const FObjectOutlinerReportCell& Bb = (bAscending ? B : A)->Cells[ColumnIndex];
+		return bText ? Aa.Text < Bb.Text : Aa.Value < Bb.Value;
+	});
+
+	for (const FObjectOutlinerReportRowPtr& Row : InRows)
+	{
+		if (Row->bKeepChildrenOrder == false)
+		{
+			SortRows(Row->Children);
+		}
+	}
+}
+
+TSharedRef<ITableRow> SObjectOutlinerReport::HandleGenerateRow(const FObjectOutlinerReportRowPtr Row, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(ReportView::SRow, OwnerTable, Row, Report.ToSharedRef());
+}
+
+void SObjectOutlinerReport::HandleGetChildren(const FObjectOutlinerReportRowPtr Row, TArray<FObjectOutlinerReportRowPtr>& OutChildren)
+{
+	OutChildren.Append(Row->Children);
+}
+
+void SObjectOutlinerReport::HandleRowDoubleClick(const FObjectOutlinerReportRowPtr Row)
+{
+	if (UObject* Object = Row->Object.Get())
+	{
+		AssetViewUtils::OpenEditorForAsset(Object);
+	}
+	else if (Row->Children.Num() > 0)
+	{
+		TreeView->SetItemExpansion(Row, !TreeView->IsItemExpanded(Row));
+	}
+}
+
+void SObjectOutlinerReport::OnColumnSortModeChanged(const EColumnSortPriority::Type /*SortPriority*/, const FName& ColumnId, const EColumnSortMode::Type InSortMode)
+{
+	SortColumnId = ColumnId;
+	SortMode = InSortMode;
+	if (Report.IsValid())
+	{
+		SortRows(Report->Rows);
+	}
+	TreeView->RequestTreeRefresh();
+}
+
+EColumnSortMode::Type SObjectOutlinerReport::GetColumnSortMode(const FName ColumnId) const
+{
+	return SortColumnId == ColumnId ? SortMode : EColumnSortMode::None;
+}
+
+FReply SObjectOutlinerReport::OnRefreshClicked()
+{
+	if (Generator.IsBound())
+	{
+		SetReport(Generator.Execute());
+	}
+	return FReply::Handled();
+}
+
+FReply SObjectOutlinerReport::OnExportClicked()
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (DesktopPlatform == nullptr || Report.IsValid() == false)
+	{
+		return FReply::Handled();
+	}
+
+	TArray<FString> OutFilenames;
+	const bool bPicked = DesktopPlatform->SaveFileDialog(
+		FSlateApplication::Get().FindBestParentWindowHandleForDialogs(AsShared()),
+		TEXT("Export Report"),
+		FPaths::ProjectSavedDir(),
+		FPaths::MakeValidFileName(Report->Title.ToString()) + TEXT(".csv"),
+		TEXT("CSV file (*.csv)|*.csv"),
+		EFileDialogFlags::None,
+		OutFilenames);
+
+	if (bPicked && OutFilenames.Num() > 0)
+	{
+		const FString Filename = OutFilenames[0];
+		const bool bSuccess = Report->SaveToCsv(Filename);
+
+		FNotificationInfo Info(bSuccess ? INVTEXT("Report exported") : INVTEXT("Failed to export report"));
+		Info.ExpireDuration = 5.0f;
+		if (bSuccess)
+		{
+			Info.Hyperlink = FSimpleDelegate::CreateLambda([Filename]() { FPlatformProcess::ExploreFolder(*Filename); });
+			Info.HyperlinkText = FText::FromString(FPaths::GetCleanFilename(Filename));
+		}
+		if (const TSharedPtr<SNotificationItem> InfoItem = FSlateNotificationManager::Get().AddNotification(Info))
+		{
+			InfoItem->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+		}
+	}
+	return FReply::Handled();
+}
+
+EActiveTimerReturnType SObjectOutlinerReport::HandleAutoRefreshTimer(double /*InCurrentTime*/, float /*InDeltaTime*/)
+{
+	OnRefreshClicked();
+	return EActiveTimerReturnType::Continue;
+}
+}
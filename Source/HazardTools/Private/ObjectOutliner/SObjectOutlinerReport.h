@@ -0,0 +1,62 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ObjectOutlinerReport.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/STreeView.h"
+
+namespace HazardTools
+{
+/**
+ * Sortable tree view of FObjectOutlinerReport with CSV export.
+ * With Generator bound the report can be regenerated manually or on a timer.
+ */
+class SObjectOutlinerReport : public SCompoundWidget
+{
+	using ThisClass = SObjectOutlinerReport;
+public:
+	SLATE_BEGIN_ARGS(SObjectOutlinerReport)
+			: _AutoRefreshInterval(2.f)
+		{
+		}
+
+		SLATE_ARGUMENT(TSharedPtr<FObjectOutlinerReport>, Report)
+		SLATE_EVENT(FObjectOutlinerReportGenerator, Generator)
+		// Seconds between regenerations when auto refresh is enabled
+		SLATE_ARGUMENT(float, AutoRefreshInterval)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	// Open report in a new window, Generator is optional
+	static void OpenWindow(const TSharedRef<FObjectOutlinerReport>& Report, const FObjectOutlinerReportGenerator& Generator = FObjectOutlinerReportGenerator());
+
+private:
+	void SetReport(const TSharedPtr<FObjectOutlinerReport>& InReport);
+	void RebuildHeaderRow();
+	void SortRows(TArray<FObjectOutlinerReportRowPtr>& InRows) const;
+
+	TSharedRef<ITableRow> HandleGenerateRow(FObjectOutlinerReportRowPtr Row, const TSharedRef<STableViewBase>& OwnerTable);
+	static void HandleGetChildren(FObjectOutlinerReportRowPtr Row, TArray<FObjectOutlinerReportRowPtr>& OutChildren);
+	void HandleRowDoubleClick(FObjectOutlinerReportRowPtr Row);
+	void OnColumnSortModeChanged(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type InSortMode);
+	EColumnSortMode::Type GetColumnSortMode(FName ColumnId) const;
+
+	FReply OnRefreshClicked();
+	FReply OnExportClicked();
+	EActiveTimerReturnType HandleAutoRefreshTimer(double InCurrentTime, float InDeltaTime);
+
+	TSharedPtr<FObjectOutlinerReport> Report;
+	FObjectOutlinerReportGenerator Generator;
+	float AutoRefreshInterval = 2.f;
+	TSharedPtr<FActiveTimerHandle> AutoRefreshTimerHandle;
+
+	TSharedPtr<SHeaderRow> HeaderRow;
+	TSharedPtr<STreeView<FObjectOutlinerReportRowPtr>> TreeView;
+
+	FName SortColumnId;
+	EColumnSortMode::Type SortMode = EColumnSortMode::None;
+};
+}
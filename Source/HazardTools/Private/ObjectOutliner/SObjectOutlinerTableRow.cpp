@@ -3,6 +3,8 @@
 #include "SObjectOutlinerTableRow.h"
 
 #include "AssetViewUtils.h"
+#include "ObjectOutlinerSerializedSize.h"
+#include "ObjectOutlinerTextureInfo.h"
 #include "ObjectOutlinerTypes.h"
 #include "SourceCodeNavigation.h"
 #include "Styling/SlateIconFinder.h"
@@ -42,13 +44,30 @@ namespace HazardTools
 				ContentColor = ContentColor.UseSubduedForeground();
 			}
 
+			// Group node object is the grouped class, tooltip describes that class instead of UClass
+			UClass* TooltipClass = Obj->GetClass();
+			FText TooltipClassName = ClassName;
+			if (Item->bIsGroupNode)
+			{
+				UClass* Class = Cast<UClass>(Item->ObjectPtr.Get());
+				TooltipClass = Class != nullptr ? Class : Obj->GetClass();
+				TooltipClassName = TooltipClass->GetDisplayNameText();
+				ClassName = FText::Format(INVTEXT("{0} objects"), FText::AsNumber(Item->GroupedNum));
+				ClassIcon = FSlateIconFinder::FindIconForClass(TooltipClass).GetIcon();
+				ContentColor = FSlateColor::UseForeground();
+			}
+
 			FTextBuilder TooltipBuilder;
 
-			TooltipBuilder.AppendLineFormat(INVTEXT("Class: {0}"), ClassName);
+			TooltipBuilder.AppendLineFormat(INVTEXT("Class: {0}"), TooltipClassName);
+			if (Item->bIsGroupNode)
+			{
+				TooltipBuilder.AppendLineFormat(INVTEXT("Objects: {0}"), FText::AsNumber(Item->GroupedNum));
+			}
 			TooltipBuilder.AppendLineFormat(INVTEXT("Package: {0}"), Package);
 
 			TooltipBuilder.AppendLine();
-			TooltipBuilder.AppendLine(Obj->GetClass()->GetToolTipText());
+			TooltipBuilder.AppendLine(TooltipClass->GetToolTipText());
 
 			if (const UObject* ObjOuter = Obj->GetOuter())
 			{
@@ -61,19 +80,19 @@ namespace HazardTools
 				}
 			}
 
-			if (FString ClassModuleName; FSourceCodeNavigation::FindClassModuleName(Obj->GetClass(), ClassModuleName))
+			if (FString ClassModuleName; FSourceCodeNavigation::FindClassModuleName(TooltipClass, ClassModuleName))
 			{
 				TooltipBuilder.AppendLine();
 				TooltipBuilder.AppendLineFormat(INVTEXT("Module: {0}"), FText::FromString(ClassModuleName));
 			}
 
-			if (FString ClassHeaderPath; FSourceCodeNavigation::FindClassHeaderPath(Obj->GetClass(), ClassHeaderPath))
+			if (FString ClassHeaderPath; FSourceCodeNavigation::FindClassHeaderPath(TooltipClass, ClassHeaderPath))
 			{
 				TooltipBuilder.AppendLine();
 				TooltipBuilder.AppendLineFormat(INVTEXT("Header: {0}"), FText::FromString(ClassHeaderPath));
 			}
 
-			if (FString ClassSourcePath; FSourceCodeNavigation::FindClassSourcePath(Obj->GetClass(), ClassSourcePath))
+			if (FString ClassSourcePath; FSourceCodeNavigation::FindClassSourcePath(TooltipClass, ClassSourcePath))
 			{
 				TooltipBuilder.AppendLineFormat(INVTEXT("Source: {0}"), FText::FromString(ClassSourcePath));
 			}
@@ -152,6 +171,14 @@ namespace HazardTools
 					.ColorAndOpacity(ContentColor);
 		}
 
+		if (ColumnName == SObjectOutliner::Column_ID_SerializedSize)
+		{
+			return
+					SNew(STextBlock)
+					.Text_Lambda([&]() { return GetSerializedSizeText(); })
+					.ColorAndOpacity(ContentColor);
+		}
+
 		if (ColumnName == SObjectOutliner::Column_ID_Memory)
 		{
 			return
@@ -160,6 +187,14 @@ namespace HazardTools
 					.ColorAndOpacity(ContentColor);
 		}
 
+		if (SObjectOutliner::IsTextureColumn(ColumnName))
+		{
+			return
+					SNew(STextBlock)
+					.Text(GetTextureColumnText(ColumnName))
+					.ColorAndOpacity(ContentColor);
+		}
+
 		return SNullWidget::NullWidget;
 	}
 
@@ -173,13 +208,69 @@ namespace HazardTools
 		return FReply::Handled();
 	}
 
-	FText SObjectOutlinerTableRow::GetMemoryText() const
+	FText SObjectOutlinerTableRow::GetSerializedSizeText() const
+	{
+		const UObject* Obj = Item->ObjectPtr.Get();
+		if (Obj == nullptr || Item->bIsGroupNode)
+		{
+			return INVTEXT("-");
+		}
+
+		FObjectOutlinerSerializedSizeCache& SizeCache = FObjectOutlinerSerializedSizeCache::Get();
+		const int64 Size = SizeCache.Find(Obj);
+		if (Size == INDEX_NONE)
+		{
+			// Row is on screen, measure it before the rest of the list
+			SizeCache.RequestVisible(Obj);
+			return INVTEXT("...");
+		}
+		return FText::AsMemory(Size, IEC);
+	}
+
+	FText SObjectOutlinerTableRow::GetTextureColumnText(const FName ColumnName) const
 	{
-		if (UObject* Obj = Item->ObjectPtr.Get())
+		const FObjectOutlinerTextureInfo* TextureInfo = Item->GetTextureInfo();
+		if (TextureInfo == nullptr)
 		{
-			const SIZE_T Size = Obj->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+			return FText::GetEmpty();
+		}
 
-			return FText::AsMemory(Size, IEC);
+		if (ColumnName == SObjectOutliner::Column_ID_TextureResident)
+		{
+			return FText::AsMemory(TextureInfo->ResidentSize, IEC);
+		}
+		if (ColumnName == SObjectOutliner::Column_ID_TextureFullSize)
+		{
+			return FText::AsMemory(TextureInfo->FullSize, IEC);
+		}
+		if (ColumnName == SObjectOutliner::Column_ID_TextureMips)
+		{
+			return TextureInfo->GetMipsText();
+		}
+		if (ColumnName == SObjectOutliner::Column_ID_TextureLODGroup)
+		{
+			return TextureInfo->LODGroup;
+		}
+		if (ColumnName == SObjectOutliner::Column_ID_TextureCompression)
+		{
+			return TextureInfo->Compression;
+		}
+		if (ColumnName == SObjectOutliner::Column_ID_TextureSource)
+		{
+			return TextureInfo->GetSourceSizeText();
+		}
+		return TextureInfo->GetStreamingText();
+	}
+
+	FText SObjectOutlinerTableRow::GetMemoryText() const
+	{
+		if (Item->bIsGroupNode)
+		{
+			return FText::AsMemory(Item->GroupedMemory, IEC);
+		}
+		if (Item->ObjectPtr.IsValid())
+		{
+			return FText::AsMemory(Item->GetMemory(), IEC);
 		}
 		return INVTEXT("-");
 	}
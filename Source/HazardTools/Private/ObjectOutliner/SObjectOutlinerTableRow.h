@@ -53,5 +53,7 @@ public:
 	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override;
 	virtual FReply OnMouseButtonDoubleClick(const FGeometry& InMyGeometry, const FPointerEvent& InMouseEvent) override;
 	FText GetMemoryText() const;
+	FText GetSerializedSizeText() const;
+	FText GetTextureColumnText(FName ColumnName) const;
 };
 }
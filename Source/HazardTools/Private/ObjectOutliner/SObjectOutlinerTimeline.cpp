@@ -0,0 +1,133 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "SObjectOutlinerTimeline.h"
+
+#include "ObjectOutlinerTimeline.h"
+
+namespace HazardTools
+{
+void SObjectOutlinerTimeline::Construct(const FArguments& /*InArgs*/)
+{
+}
+
+FVector2D SObjectOutlinerTimeline::ComputeDesiredSize(float) const
+{
+	return FVector2D(200.f, 140.f);
+}
+
+FLinearColor SObjectOutlinerTimeline::GetSeriesColor(const int32 SeriesIndex)
+{
+	// Series 0 is total count
+	if (SeriesIndex == 0)
+	{
+		return FLinearColor::White;
+	}
+	const uint8 Hue = static_cast<uint8>((SeriesIndex * 47) % 256);
+	return FLinearColor::MakeFromHSV8(Hue, 180, 240);
+}
+
+int32 SObjectOutlinerTimeline::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const FSlateBrush* WhiteBrush = FAppStyle::Get().GetBrush("WhiteBrush");
+	const FSlateFontInfo Font = FCoreStyle::GetDefaultFontStyle("Regular", 8);
+	const FVector2f Size = FVector2f(AllottedGeometry.GetLocalSize());
+
+	FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), WhiteBrush, ESlateDrawEffect::None, FLinearColor(0.01f, 0.01f, 0.01f, 1.f));
+
+	const FObjectOutlinerTimeline* Timeline = FObjectOutlinerTimeline::Get();
+	if (Timeline == nullptr || Timeline->GetSamples().Num() == 0)
+	{
+		FSlateDrawElement::MakeText(OutDrawElements, LayerId + 1, AllottedGeometry.ToPaintGeometry(), INVTEXT("Object population tracking is disabled"), Font, ESlateDrawEffect::None, FLinearColor::Gray);
+		return LayerId + 1;
+	}
+
+	const TObjectOutlinerRingBuffer<FObjectOutlinerTimelineSample>& Samples = Timeline->GetSamples();
+	const FObjectOutlinerTimelineSample& LastSample = Samples.Last();
+
+	const double MinTime = Samples[0].Time;
+	const double TimeRange = FMath::Max(LastSample.Time - MinTime, 1.0);
+
+	int32 MaxValue = 1;
+	for (int32 i = 0; i < Samples.Num(); ++i)
+	{
+		MaxValue = FMath::Max(MaxValue, Samples[i].TotalNum);
+	}
+
+	constexpr float Padding = 4.f;
+	const float GraphWidth = FMath::Max(Size.X - Padding * 2.f, 1.f);
+	const float GraphHeight = FMath::Max(Size.Y - Padding * 2.f, 1.f);
+
+	const auto ToLocal = [&](const double Time, const int32 Value)
+	{
+		return FVector2f(
+			Padding + static_cast<float>((Time - MinTime) / TimeRange) * GraphWidth,
+			Padding + GraphHeight * (1.f - static_cast<float>(Value) / MaxValue));
+	};
+
+	// Markers
+	const TObjectOutlinerRingBuffer<FObjectOutlinerTimelineMarker>& Markers = Timeline->GetMarkers();
+	for (int32 i = 0; i < Markers.Num(); ++i)
+	{
+		if (Markers[i].Time < MinTime)
+		{
+			continue;
+		}
+		const float X = ToLocal(Markers[i].Time, 0).X;
+		FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 1, AllottedGeometry.ToPaintGeometry(), {FVector2f(X, 0.f), FVector2f(X, Size.Y)}, ESlateDrawEffect::None, FLinearColor(1.f, 1.f, 0.f, 0.35f));
+		FSlateDrawElement::MakeText(OutDrawElements, LayerId + 1, AllottedGeometry.ToPaintGeometry(FVector2f(Size.X, 12.f), FSlateLayoutTransform(FVector2f(X + 2.f, Size.Y - 14.f))), Markers[i].Label, Font, ESlateDrawEffect::None, FLinearColor(1.f, 1.f, 0.f, 0.6f));
+	}
+
+	// Total series
+	{
+		TArray<FVector2f> Points;
+		Points.Reserve(Samples.Num());
+		for (int32 i = 0; i < Samples.Num(); ++i)
+		{
+			Points.Add(ToLocal(Samples[i].Time, Samples[i].TotalNum));
+		}
+		FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 2, AllottedGeometry.ToPaintGeometry(), MoveTemp(Points), ESlateDrawEffect::None, GetSeriesColor(0), true, 1.5f);
+	}
+
+	// Top classes of the latest sample, class missing from older samples' top list breaks the line
+	for (int32 ClassIdx = 0; ClassIdx < LastSample.TopClasses.Num(); ++ClassIdx)
+	{
+		const FName ClassName = LastSample.TopClasses[ClassIdx].Key;
+		TArray<FVector2f> Points;
+		for (int32 i = 0; i < Samples.Num(); ++i)
+		{
+			const int32 Num = Samples[i].FindClassNum(ClassName);
+			if (Num == INDEX_NONE)
+			{
+				if (Points.Num() > 1)
+				{
+					FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 2, AllottedGeometry.ToPaintGeometry(), Points, ESlateDrawEffect::None, GetSeriesColor(ClassIdx + 1));
+				}
+				Points.Reset();
+				continue;
+			}
+			Points.Add(ToLocal(Samples[i].Time, Num));
+		}
+		if (Points.Num() > 1)
+		{
+			FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 2, AllottedGeometry.ToPaintGeometry(), MoveTemp(Points), ESlateDrawEffect::None, GetSeriesColor(ClassIdx + 1));
+		}
+	}
+
+	// Legend
+	float LegendY = Padding;
+	const auto DrawLegendLine = [&](const FString& Text, const FLinearColor& Color)
+	{
+		FSlateDrawElement::MakeText(OutDrawElements, LayerId + 3, AllottedGeometry.ToPaintGeometry(FVector2f(Size.X, 12.f), FSlateLayoutTransform(FVector2f(Padding * 2.f, LegendY))), Text, Font, ESlateDrawEffect::None, Color);
+		LegendY += 12.f;
+	};
+
+	DrawLegendLine(FString::Printf(TEXT("Total: %d"), LastSample.TotalNum), GetSeriesColor(0));
+	for (int32 ClassIdx = 0; ClassIdx < LastSample.TopClasses.Num(); ++ClassIdx)
+	{
+		const TPair<FName, int32>& Pair = LastSample.TopClasses[ClassIdx];
+		DrawLegendLine(FString::Printf(TEXT("%s: %d"), *Pair.Key.ToString(), Pair.Value), GetSeriesColor(ClassIdx + 1));
+	}
+
+	return LayerId + 3;
+}
+}
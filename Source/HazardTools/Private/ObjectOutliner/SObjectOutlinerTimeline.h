@@ -0,0 +1,31 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+namespace HazardTools
+{
+/**
+ * Draws FObjectOutlinerTimeline samples: total object count and top classes of the latest sample, plus event markers.
+ * Everything is painted by this single widget.
+ */
+class SObjectOutlinerTimeline : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SObjectOutlinerTimeline)
+		{
+		}
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float) const override;
+
+private:
+	static FLinearColor GetSeriesColor(int32 SeriesIndex);
+};
+}
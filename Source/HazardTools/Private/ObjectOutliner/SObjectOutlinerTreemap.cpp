@@ -0,0 +1,472 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "SObjectOutlinerTreemap.h"
+
+#include "HazardToolsObjectOutlinerSettings.h"
+#include "ObjectOutlinerTypes.h"
+
+namespace HazardTools
+{
+namespace Treemap
+{
+// Rectangles smaller than this are drawn but never subdivided
+constexpr float MinSubdivideSize = 8.f;
+// Space reserved on top of a subdivided rectangle for its label
+constexpr float HeaderHeight = 14.f;
+constexpr float Inset = 1.f;
+// Exclusive memory of an object is reused by rebuilds within this time
+constexpr double MemoryCacheSeconds = 10.0;
+
+static uint8 GetClassHue(const UObject* Object)
+{
+	return Object != nullptr ? static_cast<uint8>(GetTypeHash(Object->GetClass()->GetFName()) * 37 >> 3) : 0;
+}
+}
+
+void SObjectOutlinerTreemap::Construct(const FArguments& InArgs)
+{
+	OnItemClicked = InArgs._OnItemClicked;
+	SetToolTipText(TAttribute<FText>::CreateSP(this, &ThisClass::GetHoveredText));
+}
+
+void SObjectOutlinerTreemap::SetItems(const TArray<FObjectOutlinerItemPtr>& RootItems, const EDisplayMode DisplayMode)
+{
+	PendingRootItems = RootItems;
+	PendingDisplayMode = DisplayMode;
+	bSnapshotDirty = true;
+}
+
+void SObjectOutlinerTreemap::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SLeafWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// Hidden widget is not ticked, snapshot waits until treemap is shown
+	if (bSnapshotDirty)
+	{
+		bSnapshotDirty = false;
+		RebuildSnapshot();
+		PendingRootItems.Reset();
+	}
+}
+
+void SObjectOutlinerTreemap::RebuildSnapshot()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(SObjectOutlinerTreemap::RebuildSnapshot);
+
+	// Identity of zoomed nodes, restored below as deep as they still exist
+	TArray<FObjectKey> ZoomPath;
+	for (int32 Index = 1; Index < ZoomStack.Num(); ++Index)
+	{
+		ZoomPath.Add(Nodes[ZoomStack[Index]].Object);
+	}
+
+	Nodes.Reset();
+	ZoomStack.Reset();
+	ZoomStack.Add(0);
+	HoveredRect = INDEX_NONE;
+	LayoutRects.Reset();
+	bLayoutDirty = true;
+
+	Nodes.AddDefaulted_GetRef().Label = TEXT("All");
+
+	if (PendingDisplayMode != EDisplayMode::List)
+	{
+		AddChildren(0, PendingRootItems);
+	}
+	else
+	{
+		AddClassGroups();
+	}
+
+	MemoryCache = MoveTemp(NextMemoryCache);
+	NextMemoryCache.Reset();
+
+	for (const FObjectKey& Object : ZoomPath)
+	{
+		const FNode& Parent = Nodes[ZoomStack.Last()];
+		int32 FoundIndex = INDEX_NONE;
+		for (int32 ChildIndex = Parent.FirstChild; ChildIndex != INDEX_NONE && ChildIndex < Parent.FirstChild + Parent.ChildrenNum; ++ChildIndex)
+		{
+			if (Nodes[ChildIndex].Object == Object)
+			{
+				FoundIndex = ChildIndex;
+				break;
+			}
+		}
+		if (FoundIndex == INDEX_NONE || Nodes[FoundIndex].ChildrenNum == 0)
+		{
+			break;
+		}
+		ZoomStack.Add(FoundIndex);
+	}
+}
+
+void SObjectOutlinerTreemap::AddClassGroups()
+{
+	// Flat list has no hierarchy, group it by class
+	TMap<UClass*, TArray<FObjectOutlinerItemPtr>> ItemsByClass;
+	for (const FObjectOutlinerItemPtr& Item : PendingRootItems)
+	{
+		if (const UObject* Object = Item->ObjectPtr.Get())
+		{
+			ItemsByClass.FindOrAdd(Object->GetClass()).Add(Item);
+		}
+	}
+
+	Nodes[0].FirstChild = Nodes.Num();
+	Nodes[0].ChildrenNum = ItemsByClass.Num();
+	Nodes.AddDefaulted(ItemsByClass.Num());
+
+	int32 GroupIndex = Nodes[0].FirstChild;
+	for (const TPair<UClass*, TArray<FObjectOutlinerItemPtr>>& Pair : ItemsByClass)
+	{
+		Nodes[GroupIndex].Object = FObjectKey(Pair.Key);
+		Nodes[GroupIndex].Label = Pair.Key->GetName();
+		Nodes[GroupIndex].Hue = Treemap::GetClassHue(Pair.Value[0]->ObjectPtr.Get());
+		Nodes[GroupIndex].bGroup = true;
+		AddChildren(GroupIndex, Pair.Value);
+		Nodes[0].Size += Nodes[GroupIndex].Size;
+		GroupIndex++;
+	}
+	SortChildren(0);
+}
+
+int64 SObjectOutlinerTreemap::GetItemMemory(const FObjectOutlinerItem& Item)
+{
+	const UObject* Object = Item.ObjectPtr.Get();
+	if (Object == nullptr)
+	{
+		return 0;
+	}
+
+	const FObjectKey Key(Object);
+	const double Now = FPlatformTime::Seconds();
+	if (Item.CachedMemory == INDEX_NONE)
+	{
+		// New item of an object measured by a recent rebuild
+		if (const FCachedMemory* Cached = MemoryCache.Find(Key); Cached != nullptr && Now - Cached->Time < Treemap::MemoryCacheSeconds)
+		{
+			NextMemoryCache.Add(Key, *Cached);
+			return Cached->Size;
+		}
+	}
+
+	const int64 Size = Item.GetMemory();
+	NextMemoryCache.Add(Key, {Size, Now});
+	return Size;
+}
+
+void SObjectOutlinerTreemap::AddChildren(const int32 NodeIndex, const TArray<FObjectOutlinerItemPtr>& Items)
+{
+	const int32 FirstChild = Nodes.Num();
+	Nodes.AddDefaulted(Items.Num());
+	Nodes[NodeIndex].FirstChild = FirstChild;
+	Nodes[NodeIndex].ChildrenNum = Items.Num();
+
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		FillNode(FirstChild + Index, Items[Index]);
+		Nodes[NodeIndex].Size += Nodes[FirstChild + Index].Size;
+	}
+	SortChildren(NodeIndex);
+}
+
+void SObjectOutlinerTreemap::FillNode(const int32 NodeIndex, const FObjectOutlinerItemPtr& Item)
+{
+	const UObject* Object = Item->ObjectPtr.Get();
+	{
+		FNode& Node = Nodes[NodeIndex];
+		Node.Item = Item;
+		Node.Object = FObjectKey(Object);
+		Node.Label = Object != nullptr ? Object->GetName() : TEXT("None");
+		Node.Hue = Treemap::GetClassHue(Object);
+		Node.bGroup = Item->bIsGroupNode;
+	}
+	// Group nodes only roll up their children, items kept only for their children don't count themselves
+	const int64 OwnSize = Item->bIsGroupNode || Item->bIsExplicitlyAdded == false ? 0 : FMath::Max<int64>(0, GetItemMemory(*Item));
+	Nodes[NodeIndex].OwnSize = OwnSize;
+	Nodes[NodeIndex].Size = OwnSize;
+
+	if (Item->GetChildren().Num() > 0)
+	{
+		// Nodes array may grow, don't keep references across this call
+		AddChildren(NodeIndex, Item->GetChildren().Array());
+	}
+}
+
+void SObjectOutlinerTreemap::SortChildren(const int32 NodeIndex)
+{
+	const FNode& Node = Nodes[NodeIndex];
+	if (Node.ChildrenNum > 1)
+	{
+		// Children of moved nodes are referenced by index, so moving them keeps subtrees intact
+		TArrayView<FNode>(Nodes.GetData() + Node.FirstChild, Node.ChildrenNum).StableSort([](const FNode& A, const FNode& B) { return A.Size > B.Size; });
+	}
+}
+
+void SObjectOutlinerTreemap::UpdateLayout(const FVector2f& Size) const
+{
+	if (bLayoutDirty == false && LayoutSize.Equals(Size))
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(SObjectOutlinerTreemap::UpdateLayout);
+
+	bLayoutDirty = false;
+	LayoutSize = Size;
+	LayoutRects.Reset();
+
+	if (Nodes.Num() == 0 || Nodes[ZoomStack.Last()].Size <= 0)
+	{
+		return;
+	}
+
+	const int32 MaxDepth = FMath::Max(1, UHazardToolsObjectOutlinerSettings::Get().TreemapMaxDepth);
+	LayoutRects.Add({ZoomStack.Last(), 0, FVector2f::ZeroVector, Size});
+
+	// Breadth first, parents before children
+	for (int32 RectIndex = 0; RectIndex < LayoutRects.Num(); ++RectIndex)
+	{
+		const FLayoutRect Parent = LayoutRects[RectIndex];
+		const FVector2f ParentSize = Parent.Max - Parent.Min;
+		if (Parent.Depth < MaxDepth && Nodes[Parent.NodeIndex].ChildrenNum > 0 && ParentSize.X > Treemap::MinSubdivideSize && ParentSize.Y > Treemap::HeaderHeight + Treemap::MinSubdivideSize)
+		{
+			SquarifyChildren(Parent, LayoutRects);
+		}
+	}
+}
+
+void SObjectOutlinerTreemap::SquarifyChildren(const FLayoutRect& Parent, TArray<FLayoutRect>& OutRects) const
+{
+	const FNode& ParentNode = Nodes[Parent.NodeIndex];
+
+	FVector2f Min = Parent.Min + FVector2f(Treemap::Inset, Treemap::HeaderHeight);
+	FVector2f Max = Parent.Max - FVector2f(Treemap::Inset, Treemap::Inset);
+	if (Max.X <= Min.X || Max.Y <= Min.Y)
+	{
+		return;
+	}
+
+	// Own size takes its share of the area too, it is left uncovered as parent background at the end
+	const double Scale = (Max.X - Min.X) * (Max.Y - Min.Y) / static_cast<double>(ParentNode.Size);
+
+	int32 Begin = ParentNode.FirstChild;
+	const int32 End = ParentNode.FirstChild + ParentNode.ChildrenNum;
+	while (Begin < End && Nodes[Begin].Size > 0)
+	{
+		const FVector2f Extent = Max - Min;
+		const double Side = FMath::Min(Extent.X, Extent.Y);
+		if (Side < 1.0)
+		{
+			break;
+		}
+
+		// Grow the row while the worst aspect ratio in it improves (Bruls, Huizing, van Wijk)
+		const double RowMaxArea = Nodes[Begin].Size * Scale;
+		double RowArea = 0.0;
+		double WorstRatio = TNumericLimits<double>::Max();
+		int32 RowEnd = Begin;
+		while (RowEnd < End && Nodes[RowEnd].Size > 0)
+		{
+			const double Area = Nodes[RowEnd].Size * Scale;
+			const double NewRowArea = RowArea + Area;
+			const double Ratio = FMath::Max(Side * Side * RowMaxArea / (NewRowArea * NewRowArea), NewRowArea * NewRowArea / (Side * Side * Area));
+			if (RowEnd > Begin && Ratio > WorstRatio)
+			{
+				break;
+			}
+			WorstRatio = Ratio;
+			RowArea = NewRowArea;
+			RowEnd++;
+		}
+
+		// Row is placed along the shorter side
+		const bool bVertical = Extent.X >= Extent.Y;
+		const float Thickness = static_cast<float>(RowArea / Side);
+		float Offset = 0.f;
+		for (int32 NodeIndex = Begin; NodeIndex < RowEnd; ++NodeIndex)
+		{
+			const float Length = static_cast<float>(Nodes[NodeIndex].Size * Scale / Thickness);
+			FLayoutRect& Rect = OutRects.AddDefaulted_GetRef();
+			Rect.NodeIndex = NodeIndex;
+			Rect.Depth = Parent.Depth + 1;
+			Rect.Min = bVertical ? FVector2f(Min.X, Min.Y + Offset) : FVector2f(Min.X + Offset, Min.Y);
+			Rect.Max = bVertical ? FVector2f(Min.X + Thickness, Min.Y + Offset + Length) : FVector2f(Min.X + Offset + Length, Min.Y + Thickness);
+			Offset += Length;
+		}
+
+		if (bVertical)
+		{
+			Min.X += Thickness;
+		}
+		else
+		{
+			Min.Y += Thickness;
+		}
+		Begin = RowEnd;
+	}
+}
+
+int32 SObjectOutlinerTreemap::HitTest(const FVector2f& LocalPosition) const
+{
+	// Children are after parents, so the last hit is the deepest one
+	for (int32 RectIndex = LayoutRects.Num() - 1; RectIndex >= 0; --RectIndex)
+	{
+		const FLayoutRect& Rect = LayoutRects[RectIndex];
+		if (LocalPosition.X >= Rect.Min.X && LocalPosition.Y >= Rect.Min.Y && LocalPosition.X < Rect.Max.X && LocalPosition.Y < Rect.Max.Y)
+		{
+			return RectIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+FText SObjectOutlinerTreemap::GetHoveredText() const
+{
+	if (LayoutRects.IsValidIndex(HoveredRect) == false)
+	{
+		return FText::GetEmpty();
+	}
+
+	const FNode& Node = Nodes[LayoutRects[HoveredRect].NodeIndex];
+	const FObjectOutlinerItemPtr Item = Node.Item.Pin();
+	const UObject* Object = Item.IsValid() ? Item->ObjectPtr.Get() : nullptr;
+
+	FNumberFormattingOptions PercentFormat;
+	PercentFormat.SetMaximumFractionalDigits(1);
+	return FText::Format(INVTEXT("{0}\n{1} ({2}% of view)"),
+		FText::FromString(Object != nullptr && Node.bGroup == false ? Object->GetFullName() : Node.Label),
+		FText::AsMemory(Node.Size, IEC),
+		FText::AsNumber(100.0 * Node.Size / FMath::Max<int64>(1, Nodes[ZoomStack.Last()].Size), &PercentFormat));
+}
+
+FVector2D SObjectOutlinerTreemap::ComputeDesiredSize(float) const
+{
+	return FVector2D(300.f, 200.f);
+}
+
+int32 SObjectOutlinerTreemap::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const FSlateBrush* WhiteBrush = FAppStyle::Get().GetBrush("WhiteBrush");
+	const FSlateFontInfo Font = FCoreStyle::GetDefaultFontStyle("Regular", 8);
+	const FVector2f Size = FVector2f(AllottedGeometry.GetLocalSize());
+
+	FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), WhiteBrush, ESlateDrawEffect::None, FLinearColor(0.01f, 0.01f, 0.01f, 1.f));
+
+	UpdateLayout(Size);
+	if (LayoutRects.Num() == 0)
+	{
+		FSlateDrawElement::MakeText(OutDrawElements, LayerId + 1, AllottedGeometry.ToPaintGeometry(), INVTEXT("Nothing to display"), Font, ESlateDrawEffect::None, FLinearColor::Gray);
+		return LayerId + 1;
+	}
+
+	// Approximate glyph width to cut labels without measuring every one of them
+	constexpr float CharWidth = 6.f;
+
+	int32 MaxLayer = LayerId;
+	for (int32 RectIndex = 0; RectIndex < LayoutRects.Num(); ++RectIndex)
+	{
+		const FLayoutRect& Rect = LayoutRects[RectIndex];
+		const FNode& Node = Nodes[Rect.NodeIndex];
+		const FVector2f RectSize = Rect.Max - Rect.Min - FVector2f(Treemap::Inset);
+		if (RectSize.X < 1.f || RectSize.Y < 1.f)
+		{
+			continue;
+		}
+
+		const int32 RectLayer = LayerId + 1 + Rect.Depth * 2;
+		MaxLayer = FMath::Max(MaxLayer, RectLayer + 1);
+
+		const uint8 Value = static_cast<uint8>(FMath::Max(60, 200 - Rect.Depth * 25));
+		FLinearColor Color = Node.bGroup || Rect.Depth == 0 ? FLinearColor(0.05f, 0.05f, 0.05f, 1.f) : FLinearColor::MakeFromHSV8(Node.Hue, 120, Value);
+		if (RectIndex == HoveredRect)
+		{
+			Color = Color * 1.4f;
+		}
+
+		const FPaintGeometry PaintGeometry = AllottedGeometry.ToPaintGeometry(RectSize, FSlateLayoutTransform(Rect.Min));
+		FSlateDrawElement::MakeBox(OutDrawElements, RectLayer, PaintGeometry, WhiteBrush, ESlateDrawEffect::None, Color);
+
+		if (RectSize.X > CharWidth * 4.f && RectSize.Y > Treemap::HeaderHeight - 2.f)
+		{
+			const int32 MaxChars = FMath::FloorToInt32((RectSize.X - 4.f) / CharWidth);
+			const FString Label = Node.Label.Len() > MaxChars ? Node.Label.Left(MaxChars - 1) + TEXT("~") : Node.Label;
+			FSlateDrawElement::MakeText(OutDrawElements, RectLayer + 1,
+				AllottedGeometry.ToPaintGeometry(FVector2f(RectSize.X - 4.f, Treemap::HeaderHeight), FSlateLayoutTransform(Rect.Min + FVector2f(2.f, 0.f))),
+				Label, Font, ESlateDrawEffect::None, FLinearColor(0.9f, 0.9f, 0.9f, 1.f));
+		}
+	}
+
+	return MaxLayer;
+}
+
+FReply SObjectOutlinerTreemap::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	HoveredRect = HitTest(FVector2f(MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition())));
+	return FReply::Unhandled();
+}
+
+void SObjectOutlinerTreemap::OnMouseLeave(const FPointerEvent& MouseEvent)
+{
+	SLeafWidget::OnMouseLeave(MouseEvent);
+	HoveredRect = INDEX_NONE;
+}
+
+FReply SObjectOutlinerTreemap::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (MouseEvent.GetEffectingButton() == EKeys::RightMouseButton)
+	{
+		if (ZoomStack.Num() > 1)
+		{
+			ZoomStack.Pop();
+			HoveredRect = INDEX_NONE;
+			bLayoutDirty = true;
+		}
+		return FReply::Handled();
+	}
+
+	if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
+	{
+		const int32 RectIndex = HitTest(FVector2f(MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition())));
+		if (LayoutRects.IsValidIndex(RectIndex))
+		{
+			if (const FObjectOutlinerItemPtr Item = Nodes[LayoutRects[RectIndex].NodeIndex].Item.Pin())
+			{
+				OnItemClicked.ExecuteIfBound(Item);
+			}
+		}
+		return FReply::Handled();
+	}
+	return FReply::Unhandled();
+}
+
+FReply SObjectOutlinerTreemap::OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	const int32 RectIndex = HitTest(FVector2f(MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition())));
+	if (LayoutRects.IsValidIndex(RectIndex) == false)
+	{
+		return FReply::Unhandled();
+	}
+
+	// Zoom into the top level rectangle containing the click, so each double click goes one level deeper
+	int32 NodeIndex = LayoutRects[RectIndex].NodeIndex;
+	for (const FLayoutRect& Rect : LayoutRects)
+	{
+		const FVector2f Position = FVector2f(MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()));
+		if (Rect.Depth == 1 && Position.X >= Rect.Min.X && Position.Y >= Rect.Min.Y && Position.X < Rect.Max.X && Position.Y < Rect.Max.Y)
+		{
+			NodeIndex = Rect.NodeIndex;
+			break;
+		}
+	}
+
+	if (Nodes[NodeIndex].ChildrenNum > 0 && NodeIndex != ZoomStack.Last())
+	{
+		ZoomStack.Add(NodeIndex);
+		HoveredRect = INDEX_NONE;
+		bLayoutDirty = true;
+	}
+	return FReply::Handled();
+}
+}
@@ -0,0 +1,113 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ObjectOutlinerFwd.h"
+#include "UObject/ObjectKey.h"
+#include "Widgets/SLeafWidget.h"
+
+namespace HazardTools
+{
+/**
+ * Squarified treemap of outliner items, area is proportional to exclusive memory rolled up through children.
+ * Items are flattened into a snapshot on the first tick after population, so nothing is done while treemap is hidden.
+ * Item memory is cached per object for a few seconds across populations, zoom path is kept while its nodes still exist.
+ * Layout is computed lazily on paint from the zoom root and only for levels within TreemapMaxDepth,
+ * rectangles too small to see are not subdivided.
+ * Everything is painted by this single widget, so the cost depends on visible rectangles, not on item count.
+ *
+ * Click selects item in outliner, double click zooms into it, right click zooms out.
+ */
+class SObjectOutlinerTreemap : public SLeafWidget
+{
+	using ThisClass = SObjectOutlinerTreemap;
+public:
+	DECLARE_DELEGATE_OneParam(FOnItemClicked, FObjectOutlinerItemPtr);
+
+	SLATE_BEGIN_ARGS(SObjectOutlinerTreemap)
+		{
+		}
+
+		SLATE_EVENT(FOnItemClicked, OnItemClicked)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	// Schedule snapshot rebuild from displayed items, list mode items are grouped by class
+	void SetItems(const TArray<FObjectOutlinerItemPtr>& RootItems, EDisplayMode DisplayMode);
+
+	virtual void Tick(const FGeometry& AllottedGeometry, double InCurrentTime, float InDeltaTime) override;
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float) const override;
+
+	virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual void OnMouseLeave(const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+private:
+	struct FNode
+	{
+		TWeakPtr<FObjectOutlinerItem> Item;
+		// Identity used to restore zoom path, class for list mode groups
+		FObjectKey Object;
+		FString Label;
+		// Own size plus children sizes
+		int64 Size = 0;
+		// Part of Size not covered by children, drawn as the node background
+		int64 OwnSize = 0;
+		// Children are stored contiguously and sorted by size, biggest first
+		int32 FirstChild = INDEX_NONE;
+		int32 ChildrenNum = 0;
+		uint8 Hue = 0;
+		bool bGroup = false;
+	};
+
+	struct FLayoutRect
+	{
+		int32 NodeIndex = INDEX_NONE;
+		int32 Depth = 0;
+		FVector2f Min;
+		FVector2f Max;
+	};
+
+	struct FCachedMemory
+	{
+		int64 Size = 0;
+		double Time = 0.0;
+	};
+
+	void RebuildSnapshot();
+	void AddClassGroups();
+	int64 GetItemMemory(const FObjectOutlinerItem& Item);
+	void AddChildren(int32 NodeIndex, const TArray<FObjectOutlinerItemPtr>& Items);
+	void FillNode(int32 NodeIndex, const FObjectOutlinerItemPtr& Item);
+	void SortChildren(int32 NodeIndex);
+
+	void UpdateLayout(const FVector2f& Size) const;
+	void SquarifyChildren(const FLayoutRect& Parent, TArray<FLayoutRect>& OutRects) const;
+	int32 HitTest(const FVector2f& LocalPosition) const;
+	FText GetHoveredText() const;
+
+	TArray<FObjectOutlinerItemPtr> PendingRootItems;
+	EDisplayMode PendingDisplayMode{};
+	bool bSnapshotDirty = false;
+
+	// Exclusive memory by object, entries not seen by last rebuild are dropped
+	TMap<FObjectKey, FCachedMemory> MemoryCache;
+	TMap<FObjectKey, FCachedMemory> NextMemoryCache;
+
+	TArray<FNode> Nodes;
+	// Node indices, last is the displayed root, node 0 is the snapshot root
+	TArray<int32> ZoomStack;
+	int32 HoveredRect = INDEX_NONE;
+
+	FOnItemClicked OnItemClicked;
+
+	// Rectangles parents first, so children are painted over their parents
+	mutable TArray<FLayoutRect> LayoutRects;
+	mutable FVector2f LayoutSize = FVector2f::ZeroVector;
+	mutable bool bLayoutDirty = true;
+};
+}
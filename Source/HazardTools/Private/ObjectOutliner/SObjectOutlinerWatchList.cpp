@@ -0,0 +1,321 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#include "SObjectOutlinerWatchList.h"
+
+#include "ObjectOutlinerWatchList.h"
+
+namespace HazardTools
+{
+const FName SObjectOutlinerWatchList::Column_ID_Name = "Name";
+const FName SObjectOutlinerWatchList::Column_ID_Changes = "Changes";
+const FName SObjectOutlinerWatchList::Column_ID_LastChange = "LastChange";
+
+namespace WatchList
+{
+	class SRow : public SMultiColumnTableRow<FObjectOutlinerWatchListItemPtr>
+	{
+	public:
+		SLATE_BEGIN_ARGS(SRow)
+			{
+			}
+
+		SLATE_END_ARGS()
+
+		void Construct(const FArguments& /*InArgs*/, const TSharedRef<STableViewBase>& InOwnerTableView, const FObjectOutlinerWatchListItemPtr& InItem)
+		{
+			Item = InItem;
+			SMultiColumnTableRow<FObjectOutlinerWatchListItemPtr>::Construct(FSuperRowType::FArguments(), InOwnerTableView);
+		}
+
+		virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+		{
+			if (ColumnName == SObjectOutlinerWatchList::Column_ID_Name)
+			{
+				return SNew(SHorizontalBox)
+
+					+ SHorizontalBox::Slot()
+					.AutoWidth()
+					[
+						SNew(SExpanderArrow, SharedThis(this))
+						.IndentAmount(12)
+					]
+
+					+ SHorizontalBox::Slot()
+					.FillWidth(1.f)
+					.VAlign(VAlign_Center)
+					[
+						SNew(STextBlock)
+						.Text(this, &SRow::GetNameText)
+						.ColorAndOpacity(this, &SRow::GetContentColor)
+					];
+			}
+			if (ColumnName == SObjectOutlinerWatchList::Column_ID_Changes)
+			{
+				return SNew(STextBlock)
+					.Text_Lambda([&]() { return FText::AsNumber(GetChangeNum()); })
+					.ColorAndOpacity(this, &SRow::GetContentColor);
+			}
+			if (ColumnName == SObjectOutlinerWatchList::Column_ID_LastChange)
+			{
+				return SNew(STextBlock)
+					.Text(this, &SRow::GetLastChangeText)
+					.ColorAndOpacity(this, &SRow::GetContentColor);
+			}
+			return SNullWidget::NullWidget;
+		}
+
+	private:
+		const FObjectOutlinerWatchEntry* GetEntry() const
+		{
+			const TArray<FObjectOutlinerWatchEntry>& Entries = FObjectOutlinerWatchList::Get().GetEntries();
+			return Entries.IsValidIndex(Item->EntryIndex) ? &Entries[Item->EntryIndex] : nullptr;
+		}
+
+		const FObjectOutlinerWatchedProperty* GetProperty() const
+		{
+			const FObjectOutlinerWatchEntry* Entry = GetEntry();
+			return Entry != nullptr && Entry->Properties.IsValidIndex(Item->PropertyIndex) ? &Entry->Properties[Item->PropertyIndex] : nullptr;
+		}
+
+		FText GetNameText() const
+		{
+			if (const FObjectOutlinerWatchedProperty* Property = GetProperty())
+			{
+				return FText::FromName(Property->PropertyName);
+			}
+			if (const FObjectOutlinerWatchEntry* Entry = GetEntry())
+			{
+				return Entry->Object.IsValid()
+					       ? FText::Format(INVTEXT("{0} ({1})"), FText::FromString(Entry->ObjectName), FText::FromString(Entry->Object->GetClass()->GetName()))
+					       : FText::Format(INVTEXT("{0} (destroyed)"), FText::FromString(Entry->ObjectName));
+			}
+			return FText::GetEmpty();
+		}
+
+		int32 GetChangeNum() const
+		{
+			if (const FObjectOutlinerWatchedProperty* Property = GetProperty())
+			{
+				return Property->ChangeNum;
+			}
+			const FObjectOutlinerWatchEntry* Entry = GetEntry();
+			return Entry != nullptr ? Entry->ChangeNum : 0;
+		}
+
+		uint64 GetLastChangeFrame() const
+		{
+			if (const FObjectOutlinerWatchedProperty* Property = GetProperty())
+			{
+				return Property->LastChangeFrame;
+			}
+			const FObjectOutlinerWatchEntry* Entry = GetEntry();
+			return Entry != nullptr ? Entry->LastChangeFrame : 0;
+		}
+
+		FText GetLastChangeText() const
+		{
+			const uint64 LastChangeFrame = GetLastChangeFrame();
+			if (LastChangeFrame == 0)
+			{
+				return INVTEXT("-");
+			}
+			return FText::Format(INVTEXT("{0} frames ago"), FText::AsNumber(GFrameCounter - LastChangeFrame));
+		}
+
+		FSlateColor GetContentColor() const
+		{
+			const uint64 LastChangeFrame = GetLastChangeFrame();
+			if (LastChangeFrame != 0 && GFrameCounter - LastChangeFrame <= SObjectOutlinerWatchList::HighlightFrames)
+			{
+				static FSlateColor ColorAccentOrange = FAppStyle::Get().GetSlateColor("Colors.AccentOrange");
+				return ColorAccentOrange;
+			}
+			if (GetChangeNum() == 0)
+			{
+				return FSlateColor::UseSubduedForeground();
+			}
+			return FSlateColor::UseForeground();
+		}
+
+		FObjectOutlinerWatchListItemPtr Item;
+	};
+}
+
+void SObjectOutlinerWatchList::Construct(const FArguments& /*InArgs*/)
+{
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.f)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SCheckBox)
+				.ToolTipText(INVTEXT("Hide properties which never changed"))
+				.IsChecked_Lambda([&]() { return bOnlyChanged ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+				.OnCheckStateChanged_Lambda([&](const ECheckBoxState NewState)
+				{
+					bOnlyChanged = NewState == ECheckBoxState::Checked;
+					BuiltRevision = MAX_uint32;
+				})
+				[
+					SNew(STextBlock)
+					.Text(INVTEXT("Only changed"))
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			[
+				SNullWidget::NullWidget
+			]
+
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.Text(INVTEXT("Clear"))
+				.OnClicked_Lambda([]()
+				{
+					FObjectOutlinerWatchList::Get().Reset();
+					return FReply::Handled();
+				})
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SAssignNew(TreeView, STreeView<FObjectOutlinerWatchListItemPtr>)
+			.TreeItemsSource(&RootItems)
+			.SelectionMode(ESelectionMode::Single)
+			.OnGenerateRow(this, &ThisClass::HandleGenerateRow)
+			.OnGetChildren_Static(&ThisClass::HandleGetChildren)
+			.OnContextMenuOpening(this, &ThisClass::GetContextMenuContent)
+			.HeaderRow
+			(
+				SNew(SHeaderRow)
+
+				+ SHeaderRow::Column(Column_ID_Name)
+				.DefaultLabel(INVTEXT("Name"))
+				.FillWidth(0.6f)
+
+				+ SHeaderRow::Column(Column_ID_Changes)
+				.DefaultLabel(INVTEXT("Changed Frames"))
+				.FillWidth(0.2f)
+
+				+ SHeaderRow::Column(Column_ID_LastChange)
+				.DefaultLabel(INVTEXT("Last Change"))
+				.FillWidth(0.2f)
+			)
+		]
+	];
+}
+
+void SObjectOutlinerWatchList::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// Newly changed properties should appear in "only changed" mode
+	if (BuiltRevision != FObjectOutlinerWatchList::Get().GetRevision() || (bOnlyChanged && BuiltChangedPropertiesNum != CountChangedProperties()))
+	{
+		RebuildItems();
+	}
+}
+
+int32 SObjectOutlinerWatchList::CountChangedProperties()
+{
+	int32 Result = 0;
+	for (const FObjectOutlinerWatchEntry& Entry : FObjectOutlinerWatchList::Get().GetEntries())
+	{
+		for (const FObjectOutlinerWatchedProperty& Property : Entry.Properties)
+		{
+			Result += Property.ChangeNum > 0 ? 1 : 0;
+		}
+	}
+	return Result;
+}
+
+void SObjectOutlinerWatchList::RebuildItems()
+{
+	const FObjectOutlinerWatchList& WatchList = FObjectOutlinerWatchList::Get();
+	BuiltRevision = WatchList.GetRevision();
+	BuiltChangedPropertiesNum = CountChangedProperties();
+
+	TSet<int32> ExpandedEntries;
+	for (const FObjectOutlinerWatchListItemPtr& Item : RootItems)
+	{
+		if (TreeView->IsItemExpanded(Item))
+		{
+			ExpandedEntries.Add(Item->EntryIndex);
+		}
+	}
+
+	const bool bRebuildingSameList = RootItems.Num() == WatchList.GetEntries().Num();
+	RootItems.Reset();
+
+	const TArray<FObjectOutlinerWatchEntry>& Entries = WatchList.GetEntries();
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		FObjectOutlinerWatchListItemPtr& EntryItem = RootItems.Add_GetRef(MakeShared<FObjectOutlinerWatchListItem>());
+		EntryItem->EntryIndex = EntryIndex;
+
+		const TArray<FObjectOutlinerWatchedProperty>& Properties = Entries[EntryIndex].Properties;
+		for (int32 PropertyIndex = 0; PropertyIndex < Properties.Num(); ++PropertyIndex)
+		{
+			if (bOnlyChanged && Properties[PropertyIndex].ChangeNum == 0)
+			{
+				continue;
+			}
+			const FObjectOutlinerWatchListItemPtr& PropertyItem = EntryItem->Children.Add_GetRef(MakeShared<FObjectOutlinerWatchListItem>());
+			PropertyItem->EntryIndex = EntryIndex;
+			PropertyItem->PropertyIndex = PropertyIndex;
+		}
+
+		// Indices are stable unless entries were added or removed
+		if (bRebuildingSameList ? ExpandedEntries.Contains(EntryIndex) : Entries.Num() == 1)
+		{
+			TreeView->SetItemExpansion(EntryItem, true);
+		}
+	}
+
+	TreeView->RequestTreeRefresh();
+}
+
+TSharedRef<ITableRow> SObjectOutlinerWatchList::HandleGenerateRow(const FObjectOutlinerWatchListItemPtr Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(WatchList::SRow, OwnerTable, Item);
+}
+
+void SObjectOutlinerWatchList::HandleGetChildren(const FObjectOutlinerWatchListItemPtr Item, TArray<FObjectOutlinerWatchListItemPtr>& OutChildren)
+{
+	OutChildren.Append(Item->Children);
+}
+
+TSharedPtr<SWidget> SObjectOutlinerWatchList::GetContextMenuContent()
+{
+	const TArray<FObjectOutlinerWatchListItemPtr> SelectedItems = TreeView->GetSelectedItems();
+	if (SelectedItems.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	const int32 EntryIndex = SelectedItems[0]->EntryIndex;
+
+	FMenuBuilder MenuBuilder(true, nullptr);
+	MenuBuilder.AddMenuEntry(
+		INVTEXT("Remove from Watch List"),
+		FText::GetEmpty(),
+		FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Delete"),
+		FUIAction(FExecuteAction::CreateLambda([EntryIndex]() { FObjectOutlinerWatchList::Get().Remove(EntryIndex); }))
+		);
+	return MenuBuilder.MakeWidget();
+}
+}
@@ -0,0 +1,57 @@
+﻿// Copyright Neyl Sullivan 2022
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/STreeView.h"
+
+namespace HazardTools
+{
+struct FObjectOutlinerWatchListItem
+{
+	int32 EntryIndex = INDEX_NONE;
+	int32 PropertyIndex = INDEX_NONE; // INDEX_NONE for object rows
+	TArray<TSharedPtr<FObjectOutlinerWatchListItem>> Children;
+};
+
+using FObjectOutlinerWatchListItemPtr = TSharedPtr<FObjectOutlinerWatchListItem>;
+
+/**
+ * Displays FObjectOutlinerWatchList entries, object rows with their properties as children.
+ * Counters are read every paint, recently changed rows are highlighted.
+ */
+class SObjectOutlinerWatchList : public SCompoundWidget
+{
+	using ThisClass = SObjectOutlinerWatchList;
+public:
+	SLATE_BEGIN_ARGS(SObjectOutlinerWatchList)
+		{
+		}
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+	virtual void Tick(const FGeometry& AllottedGeometry, double InCurrentTime, float InDeltaTime) override;
+
+	static const FName Column_ID_Name;
+	static const FName Column_ID_Changes;
+	static const FName Column_ID_LastChange;
+
+	// Rows changed during this amount of frames are highlighted
+	static constexpr uint64 HighlightFrames = 30;
+
+private:
+	void RebuildItems();
+	static int32 CountChangedProperties();
+	TSharedRef<ITableRow> HandleGenerateRow(FObjectOutlinerWatchListItemPtr Item, const TSharedRef<STableViewBase>& OwnerTable);
+	static void HandleGetChildren(FObjectOutlinerWatchListItemPtr Item, TArray<FObjectOutlinerWatchListItemPtr>& OutChildren);
+	TSharedPtr<SWidget> GetContextMenuContent();
+
+	TSharedPtr<STreeView<FObjectOutlinerWatchListItemPtr>> TreeView;
+	TArray<FObjectOutlinerWatchListItemPtr> RootItems;
+	uint32 BuiltRevision = MAX_uint32;
+	int32 BuiltChangedPropertiesNum = 0;
+	bool bOnlyChanged = false;
+};
+}
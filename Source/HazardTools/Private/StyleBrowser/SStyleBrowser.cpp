@@ -130,7 +130,8 @@ void SStyleBrowser::Construct(const FArguments& InArgs)
 		]
 	];
 
-	Populate();
+	// Don't collect styles during layout restore on editor startup, see HandleDeferredPopulate
+	RegisterActiveTimer(0.1f, FWidgetActiveTimerDelegate::CreateSP(this, &ThisClass::HandleDeferredPopulate));
 }
 
 float SStyleBrowser::GetAvailableStyleSetsDropDownButtonWidth() const
@@ -445,7 +446,7 @@ END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 FSlateColor SStyleBrowser::GetFilterStatusTextColor() const
 {
-	if (IsTextFilterActive() == false)
+	if (bPopulatePending || IsTextFilterActive() == false)
 	{
 		return FSlateColor::UseForeground();
 	}
@@ -505,6 +506,11 @@ void SStyleBrowser::HandleListSelectionChanged(const FStyleBrowserItemPtr InItem
 
 FText SStyleBrowser::GetFilterStatusText() const
 {
+	if (bPopulatePending)
+	{
+		return INVTEXT("Scanning...");
+	}
+
 	if (IsTextFilterActive() == false)
 	{
 		return FText::Format(INVTEXT("{0} styles"), FText::AsNumber(Model->GetTotalNum()));
@@ -517,8 +523,26 @@ FText SStyleBrowser::GetFilterStatusText() const
 	return FText::Format(INVTEXT("Filtered {0} from {1} styles"), FText::AsNumber(Model->GetFilteredNum()), FText::AsNumber(Model->GetTotalNum()));
 }
 
+EActiveTimerReturnType SStyleBrowser::HandleDeferredPopulate(double InCurrentTime, float InDeltaTime)
+{
+	if (FHazardToolsUtils::IsEditorIdle() == false)
+	{
+		return EActiveTimerReturnType::Continue;
+	}
+
+	bPopulatePending = false;
+	Populate();
+	return EActiveTimerReturnType::Stop;
+}
+
 void SStyleBrowser::Populate() const
 {
+	// Settings changed before first population will be picked up by it
+	if (bPopulatePending)
+	{
+		return;
+	}
+
 	Model->UpdateContent();
 	ListView->RequestListRefresh();
 }
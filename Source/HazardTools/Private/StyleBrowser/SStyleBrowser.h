@@ -60,6 +60,9 @@ private:
 
 	void Populate() const;
 
+	// First population waits until the tab is painted (active timers only tick for visible widgets) and editor is idle
+	EActiveTimerReturnType HandleDeferredPopulate(double InCurrentTime, float InDeltaTime);
+
 	/** Called by the editable text control when the filter text is changed by the user */
 	void OnFilterTextChanged(const FText& InFilterText) const;
 
@@ -78,6 +81,7 @@ private:
 	TSharedPtr<SRichTextBlock> PreviewAreaFooterText;
 	TSharedPtr<SBox> PreviewAreaBox;
 	TSharedPtr<FStyleBrowserModel> Model;
+	bool bPopulatePending = true;
 	TSharedPtr<TTextFilter<const FStyleBrowserItemPtr&>> SearchBoxFilter;
 
 	TSharedPtr<FSegmentedControlStyle> CustomSegmentedControlStyle;